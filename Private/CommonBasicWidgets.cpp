@@ -2,6 +2,8 @@
 
 #include "CommonBasicWidgets.h"
 
+#include "WidgetTransition/WidgetTransitionScheduler.h"
+
 #define LOCTEXT_NAMESPACE "FCommonBasicWidgetsModule"
 
 void FCommonBasicWidgetsModule::StartupModule()
@@ -13,6 +15,7 @@ void FCommonBasicWidgetsModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FWidgetTransitionScheduler::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,256 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListBenchmarkWidgets.h"
+
+#include "Blueprint/WidgetTree.h"
+#include "Components/CanvasPanel.h"
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectArray.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogIndexedListBenchmark, Log, All);
+
+void UIndexedListBenchmarkEntry::BindToIndex_Implementation(UIndexedListContainer* ListContainer, int32 InItemIndex)
+{
+	ItemIndex = InItemIndex;
+}
+
+UIndexedListBenchmarkContainer::UIndexedListBenchmarkContainer(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	bVirtualize = true;
+	EntryWidgetClass = UIndexedListBenchmarkEntry::StaticClass();
+	SelectionMode = EIndexedListSelectionMode::Multi;
+	bScrollSelectionIntoView = false;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+void UIndexedListBenchmarkContainer::SimulateFrame(UCanvasPanel* InEntriesCanvas, const FVector2D& InViewportSize)
+{
+	RefreshVirtualizationForTesting(InEntriesCanvas, InViewportSize);
+}
+
+static TAutoConsoleVariable<FString> CVarIndexedListBenchmarkItemCounts(
+	TEXT("IndexedList.BenchmarkItemCounts"),
+	TEXT("1000 10000 100000 1000000"),
+	TEXT("Space separated item counts the CommonBasicWidgets.IndexedListContainer.Benchmark automation test runs at."));
+
+namespace IndexedListBenchmark
+{
+	constexpr int32 ScrollFrames = 600;
+	constexpr int32 ToggleCount = 1000;
+	constexpr double ScrollPerFrame = 37.0;
+	const FVector2D ViewportSize(1920.0, 1080.0);
+
+	struct FResult
+	{
+		int32 NumItems = 0;
+		double OpenMs = 0.0;
+		double ScrollAverageMs = 0.0;
+		double ScrollP95Ms = 0.0;
+		double ScrollMaxMs = 0.0;
+		double SelectAllMs = 0.0;
+		double InvertSelectionMs = 0.0;
+		double SelectRangeMs = 0.0;
+		double ToggleAverageUs = 0.0;
+		int64 PeakMemoryDeltaBytes = 0;
+		int32 PeakUObjectDelta = 0;
+	};
+
+	/** Tracks the highest memory and UObject counts seen since construction. Sampled outside the timed sections. */
+	struct FPeakTracker
+	{
+		uint64 BaseMemory = FPlatformMemory::GetStats().UsedPhysical;
+		int32 BaseUObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		int64 PeakMemoryDelta = 0;
+		int32 PeakUObjectDelta = 0;
+
+		void Sample()
+		{
+			PeakMemoryDelta = FMath::Max(PeakMemoryDelta, static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(BaseMemory));
+			PeakUObjectDelta = FMath::Max(PeakUObjectDelta, GUObjectArray.GetObjectArrayNumMinusAvailable() - BaseUObjects);
+		}
+	};
+
+	double MillisecondsSince(double InStartTime)
+	{
+		return (FPlatformTime::Seconds() - InStartTime) * 1000.0;
+	}
+
+	UWorld* FindWorld()
+	{
+		if (!GEngine)
+		{
+			return nullptr;
+		}
+
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if (UWorld* World = Context.World())
+			{
+				return World;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Drives a virtualized container without ticking Slate, so it runs headless.
+	 * Every simulated frame is one refresh of the virtualized rows.
+	 */
+	FResult RunOne(FAutomationTestBase& Test, UWorld* World, int32 InNumItems)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		FResult Result;
+		Result.NumItems = InNumItems;
+		FPeakTracker Peak;
+
+		UIndexedListBenchmarkContainer* Container = CreateWidget<UIndexedListBenchmarkContainer>(World);
+		if (!Container->WidgetTree)
+		{
+			Container->WidgetTree = NewObject<UWidgetTree>(Container, TEXT("WidgetTree"), RF_Transient);
+		}
+
+		UCanvasPanel* Canvas = Container->WidgetTree->ConstructWidget<UCanvasPanel>();
+		Container->WidgetTree->RootWidget = Canvas;
+		Container->TakeWidget();
+
+		// Opening is setting the count and building the first screen of entries.
+		double StartTime = FPlatformTime::Seconds();
+		Container->SetElementsCount(InNumItems);
+		Container->SimulateFrame(Canvas, ViewportSize);
+		Result.OpenMs = MillisecondsSince(StartTime);
+		Peak.Sample();
+
+		Test.TestTrue(FString::Printf(TEXT("%d items: visible entries materialized"), InNumItems), Container->AreVisibleEntriesMaterialized());
+		Test.TestNotNull(FString::Printf(TEXT("%d items: first row has an entry"), InNumItems), Container->GetEntryWidgetForIndex(0));
+
+		TArray<double> FrameTimes;
+		FrameTimes.Reserve(ScrollFrames);
+		for (int32 Frame = 0; Frame < ScrollFrames; ++Frame)
+		{
+			StartTime = FPlatformTime::Seconds();
+			Container->SetScrollOffset(Container->GetScrollOffset() + ScrollPerFrame);
+			Container->SimulateFrame(Canvas, ViewportSize);
+			FrameTimes.Add(MillisecondsSince(StartTime));
+			Peak.Sample();
+		}
+
+		FrameTimes.Sort();
+		double FrameTimeSum = 0.0;
+		for (const double FrameTime : FrameTimes)
+		{
+			FrameTimeSum += FrameTime;
+		}
+		Result.ScrollAverageMs = FrameTimeSum / FrameTimes.Num();
+		Result.ScrollP95Ms = FrameTimes[FMath::Min(FMath::FloorToInt32(FrameTimes.Num() * 0.95), FrameTimes.Num() - 1)];
+		Result.ScrollMaxMs = FrameTimes.Last();
+
+		StartTime = FPlatformTime::Seconds();
+		Container->SelectAll();
+		Result.SelectAllMs = MillisecondsSince(StartTime);
+		Peak.Sample();
+
+		Test.TestEqual(FString::Printf(TEXT("%d items: select all"), InNumItems), Container->GetSelectedCount(), InNumItems);
+
+		StartTime = FPlatformTime::Seconds();
+		Container->InvertSelection();
+		Result.InvertSelectionMs = MillisecondsSince(StartTime);
+		Peak.Sample();
+
+		StartTime = FPlatformTime::Seconds();
+		Container->SelectRange(InNumItems / 4, InNumItems * 3 / 4, false);
+		Result.SelectRangeMs = MillisecondsSince(StartTime);
+		Peak.Sample();
+
+		// Every other item, so the selection fragments into many ranges.
+		double ToggleMs = 0.0;
+		for (int32 Toggle = 0; Toggle < ToggleCount; ++Toggle)
+		{
+			StartTime = FPlatformTime::Seconds();
+			Container->ToggleItemSelection((Toggle * 2) % InNumItems);
+			ToggleMs += MillisecondsSince(StartTime);
+			Peak.Sample();
+		}
+		Result.ToggleAverageUs = ToggleMs * 1000.0 / ToggleCount;
+
+		Result.PeakMemoryDeltaBytes = Peak.PeakMemoryDelta;
+		Result.PeakUObjectDelta = Peak.PeakUObjectDelta;
+
+		// An empty list releases every entry on its next frame.
+		Container->SetElementsCount(0);
+		Container->SimulateFrame(Canvas, ViewportSize);
+		Container->MarkAsGarbage();
+
+		Test.AddInfo(FString::Printf(TEXT("%d items: open %.3f ms, scroll avg %.3f ms p95 %.3f ms max %.3f ms, select all %.3f ms, invert %.3f ms, range %.3f ms, toggle %.3f us, memory +%lld bytes, UObjects +%d"),
+			Result.NumItems, Result.OpenMs, Result.ScrollAverageMs, Result.ScrollP95Ms, Result.ScrollMaxMs, Result.SelectAllMs, Result.InvertSelectionMs,
+			Result.SelectRangeMs, Result.ToggleAverageUs, Result.PeakMemoryDeltaBytes, Result.PeakUObjectDelta));
+
+		return Result;
+	}
+
+	void WriteCsv(const TArray<FResult>& InResults)
+	{
+		FString Csv = TEXT("BuildVersion,NumItems,OpenMs,ScrollAverageMs,ScrollP95Ms,ScrollMaxMs,SelectAllMs,InvertSelectionMs,SelectRangeMs,ToggleAverageUs,PeakMemoryDeltaBytes,PeakUObjectDelta\n");
+		for (const FResult& Result : InResults)
+		{
+			Csv += FString::Printf(TEXT("%s,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%lld,%d\n"),
+				FApp::GetBuildVersion(), Result.NumItems, Result.OpenMs, Result.ScrollAverageMs, Result.ScrollP95Ms, Result.ScrollMaxMs,
+				Result.SelectAllMs, Result.InvertSelectionMs, Result.SelectRangeMs, Result.ToggleAverageUs, Result.PeakMemoryDeltaBytes, Result.PeakUObjectDelta);
+		}
+
+		const FString FileName = FString::Printf(TEXT("IndexedListBenchmark-%s.csv"), *FDateTime::Now().ToString());
+		const FString FilePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("IndexedListBenchmark"), FileName);
+
+		if (!FFileHelper::SaveStringToFile(Csv, *FilePath))
+		{
+			UE_LOG(LogIndexedListBenchmark, Warning, TEXT("Failed to write benchmark results to %s"), *FilePath);
+			return;
+		}
+
+		UE_LOG(LogIndexedListBenchmark, Display, TEXT("Benchmark results written to %s"), *IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*FilePath));
+	}
+}
+
+/**
+ * Measures open, scroll and selection cost of a virtualized IndexedListContainer at the counts of
+ * IndexedList.BenchmarkItemCounts and writes them as CSV to Saved/Profiling/IndexedListBenchmark. Runs headless, e.g.
+ * UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests CommonBasicWidgets.IndexedListContainer.Benchmark; Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FIndexedListBenchmarkTest, "CommonBasicWidgets.IndexedListContainer.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FIndexedListBenchmarkTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = IndexedListBenchmark::FindWorld();
+	if (!TestNotNull(TEXT("World to create the container in"), World))
+	{
+		return false;
+	}
+
+	TArray<FString> CountArgs;
+	CVarIndexedListBenchmarkItemCounts.GetValueOnGameThread().ParseIntoArrayWS(CountArgs);
+
+	TArray<IndexedListBenchmark::FResult> Results;
+	for (const FString& Arg : CountArgs)
+	{
+		const int32 Count = FCString::Atoi(*Arg);
+		if (Count > 0)
+		{
+			Results.Add(IndexedListBenchmark::RunOne(*this, World, Count));
+		}
+	}
+
+	IndexedListBenchmark::WriteCsv(Results);
+	return !HasAnyErrors();
+}
+
+#endif
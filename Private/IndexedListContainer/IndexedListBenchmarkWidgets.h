@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "IndexedListContainer/UMG/IndexedListContainer.h"
+#include "IndexedListContainer/UMG/IndexedListEntryInterface.h"
+#include "IndexedListBenchmarkWidgets.generated.h"
+
+/** Entry without any content, so the benchmark measures the container and not entry layout. */
+UCLASS(Hidden, NotBlueprintable)
+class UIndexedListBenchmarkEntry : public UUserWidget, public IIndexedListEntryInterface
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BindToIndex_Implementation(UIndexedListContainer* ListContainer, int32 InItemIndex) override;
+
+	int32 ItemIndex = INDEX_NONE;
+};
+
+/** Concrete container built in code by the benchmark, configured for multi selection over benchmark entries. */
+UCLASS(Hidden, NotBlueprintable)
+class UIndexedListBenchmarkContainer : public UIndexedListContainer
+{
+	GENERATED_BODY()
+
+public:
+	UIndexedListBenchmarkContainer(const FObjectInitializer& ObjectInitializer);
+
+#if WITH_DEV_AUTOMATION_TESTS
+	/** One simulated frame, the work the container does per tick. */
+	void SimulateFrame(UCanvasPanel* InEntriesCanvas, const FVector2D& InViewportSize);
+#endif
+};
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListContainer/IndexedListFakePagedDataSource.h"
+
+int32 UIndexedListFakePagedDataSource::GetNumRequestedPages() const noexcept
+{
+	return NumRequestedPages;
+}
+
+void UIndexedListFakePagedDataSource::RequestPage_Implementation(int32 InPageIndex, int32 InFirstIndex, int32 InCount, int32 InRequestId)
+{
+	++NumRequestedPages;
+
+	const float Delay = SimulatedLatency + FMath::FRandRange(0.f, LatencyJitter);
+	TWeakObjectPtr<UIndexedListFakePagedDataSource> WeakThis(this);
+
+	PendingTickers.Add(InRequestId, FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[WeakThis, InPageIndex, InFirstIndex, InCount, InRequestId](float)
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->CompleteRequest(InPageIndex, InFirstIndex, InCount, InRequestId);
+			}
+			return false;
+		}), Delay));
+}
+
+void UIndexedListFakePagedDataSource::BeginDestroy()
+{
+	for (const auto& Pair : PendingTickers)
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(Pair.Value);
+	}
+	PendingTickers.Empty();
+
+	Super::BeginDestroy();
+}
+
+void UIndexedListFakePagedDataSource::CompleteRequest(int32 InPageIndex, int32 InFirstIndex, int32 InCount, int32 InRequestId)
+{
+	PendingTickers.Remove(InRequestId);
+
+	if (FMath::FRand() < FailureRate)
+	{
+		FailPage(InPageIndex, InRequestId);
+		return;
+	}
+
+	TArray<UObject*> Rows;
+	Rows.Reserve(InCount);
+	for (int32 Index = InFirstIndex; Index < InFirstIndex + InCount; ++Index)
+	{
+		UIndexedListFakeRow* Row = NewObject<UIndexedListFakeRow>(this);
+		Row->Index = Index;
+		Row->Label = FText::Format(NSLOCTEXT("CommonBasicWidgets", "FakeRowLabel", "Row {0}"), Index);
+		Rows.Add(Row);
+	}
+
+	FulfillPage(InPageIndex, InRequestId, Rows);
+}
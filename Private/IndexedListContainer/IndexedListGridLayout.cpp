@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListContainer/IndexedListGridLayout.h"
+
+bool FIndexedListGridLayout::Configure(double InViewportWidth, const FVector2D& InTileSize, const FVector2D& InSpacing)
+{
+	TileSize = FVector2D(FMath::Max(InTileSize.X, 1.0), FMath::Max(InTileSize.Y, 1.0));
+	ColumnStride = TileSize.X + FMath::Max(InSpacing.X, 0.0);
+	LineStride = TileSize.Y + FMath::Max(InSpacing.Y, 0.0);
+
+	// The last column doesn't need spacing after it.
+	const int32 PreviousNumColumns = NumColumns;
+	NumColumns = FMath::Max(FMath::FloorToInt32((InViewportWidth + ColumnStride - TileSize.X) / ColumnStride), 1);
+	return NumColumns != PreviousNumColumns;
+}
+
+double FIndexedListGridLayout::GetContentExtent(int32 InNumRows) const
+{
+	if (InNumRows <= 0)
+	{
+		return 0.0;
+	}
+
+	const int32 NumLines = FMath::DivideAndRoundUp(InNumRows, NumColumns);
+	return static_cast<double>(NumLines - 1) * LineStride + TileSize.Y;
+}
+
+bool FIndexedListGridLayout::GetRowsInRange(double InTop, double InBottom, int32 InNumRows, int32 InOverscanLines, int32& OutFirstRow, int32& OutEndRow) const
+{
+	if (InNumRows <= 0 || InBottom <= InTop)
+	{
+		return false;
+	}
+
+	const int32 NumLines = FMath::DivideAndRoundUp(InNumRows, NumColumns);
+	const int32 FirstLine = FMath::Clamp(FMath::FloorToInt32(InTop / LineStride) - InOverscanLines, 0, NumLines - 1);
+	const int32 EndLine = FMath::Clamp(FMath::CeilToInt32(InBottom / LineStride) + InOverscanLines, FirstLine + 1, NumLines);
+
+	OutFirstRow = FirstLine * NumColumns;
+	OutEndRow = FMath::Min(EndLine * NumColumns, InNumRows);
+	return OutFirstRow < OutEndRow;
+}
+
+int32 FIndexedListGridLayout::FindRowAtOffset(double InOffset, int32 InNumRows) const
+{
+	if (InNumRows <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 NumLines = FMath::DivideAndRoundUp(InNumRows, NumColumns);
+	return FMath::Clamp(FMath::FloorToInt32(InOffset / LineStride), 0, NumLines - 1) * NumColumns;
+}
+
+void FIndexedListGridLayout::Compute(int32 InFirstRow, int32 InEndRow)
+{
+	const int32 Count = FMath::Max(InEndRow - InFirstRow, 0);
+	PositionsX.SetNumUninitialized(Count, EAllowShrinking::No);
+	PositionsY.SetNumUninitialized(Count, EAllowShrinking::No);
+
+	ComputedFirstRow = InFirstRow;
+	ComputedTop = GetLineTop(InFirstRow);
+
+	const int32 FirstLine = InFirstRow / NumColumns;
+	float* RESTRICT OutX = PositionsX.GetData();
+	float* RESTRICT OutY = PositionsY.GetData();
+
+	// One run per line, the inner loop has no dependencies between iterations and vectorizes.
+	for (int32 Row = InFirstRow; Row < InEndRow;)
+	{
+		const int32 Line = Row / NumColumns;
+		const int32 Column = Row - Line * NumColumns;
+		const int32 RunCount = FMath::Min(NumColumns - Column, InEndRow - Row);
+		const float LineY = static_cast<float>((Line - FirstLine) * LineStride);
+		const int32 Out = Row - InFirstRow;
+
+		for (int32 Step = 0; Step < RunCount; ++Step)
+		{
+			OutX[Out + Step] = static_cast<float>((Column + Step) * ColumnStride);
+			OutY[Out + Step] = LineY;
+		}
+
+		Row += RunCount;
+	}
+}
+
+FVector2D FIndexedListGridLayout::GetPosition(int32 InRow) const
+{
+	const int32 Slot = InRow - ComputedFirstRow;
+	if (!PositionsX.IsValidIndex(Slot))
+	{
+		return FVector2D(static_cast<double>(InRow % NumColumns) * ColumnStride, GetLineTop(InRow));
+	}
+
+	return FVector2D(PositionsX[Slot], ComputedTop + PositionsY[Slot]);
+}
@@ -0,0 +1,158 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListContainer/IndexedListOffsetIndex.h"
+
+namespace IndexedListOffsetIndex
+{
+	FORCEINLINE int32 LowBit(int32 Value)
+	{
+		return Value & -Value;
+	}
+}
+
+void FIndexedListOffsetIndex::Reset(int32 InNum, float InHeight)
+{
+	Heights.Init(InHeight, FMath::Max(InNum, 0));
+	Build();
+}
+
+void FIndexedListOffsetIndex::Reset(TArray<float>&& InHeights)
+{
+	Heights = MoveTemp(InHeights);
+	Build();
+}
+
+float FIndexedListOffsetIndex::SetHeight(int32 InIndex, float InHeight)
+{
+	const float Delta = InHeight - Heights[InIndex];
+	if (Delta != 0.f)
+	{
+		Heights[InIndex] = InHeight;
+		AddDelta(InIndex, Delta);
+	}
+
+	return Delta;
+}
+
+double FIndexedListOffsetIndex::GetOffset(int32 InIndex) const
+{
+	double Sum = 0.0;
+	for (int32 Node = FMath::Min(InIndex, Num()); Node > 0; Node -= IndexedListOffsetIndex::LowBit(Node))
+	{
+		Sum += Tree[Node];
+	}
+
+	return Sum;
+}
+
+int32 FIndexedListOffsetIndex::FindIndexAtOffset(double InOffset) const
+{
+	const int32 Count = Num();
+	if (Count == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Position = 0;
+	double Remaining = InOffset;
+	for (int32 Step = FMath::RoundDownToPowerOfTwo(static_cast<uint32>(Count)); Step > 0; Step >>= 1)
+	{
+		const int32 Next = Position + Step;
+		if (Next <= Count && Tree[Next] <= Remaining)
+		{
+			Position = Next;
+			Remaining -= Tree[Next];
+		}
+	}
+
+	return FMath::Clamp(Position, 0, Count - 1);
+}
+
+void FIndexedListOffsetIndex::Insert(int32 InIndex, TArrayView<const float> InHeights)
+{
+	if (InIndex == Num())
+	{
+		Heights.Reserve(Num() + InHeights.Num());
+		Tree.Reserve(Num() + InHeights.Num() + 1);
+		for (const float Height : InHeights)
+		{
+			Append(Height);
+		}
+		return;
+	}
+
+	Heights.Insert(InHeights.GetData(), InHeights.Num(), InIndex);
+	Build();
+}
+
+void FIndexedListOffsetIndex::Remove(int32 InIndex, int32 InCount)
+{
+	Heights.RemoveAt(InIndex, InCount, EAllowShrinking::No);
+
+	if (InIndex == Num())
+	{
+		// Fenwick nodes never depend on later rows, so trimming the tail keeps the rest valid.
+		Tree.SetNum(Num() + 1, EAllowShrinking::No);
+		return;
+	}
+
+	Build();
+}
+
+void FIndexedListOffsetIndex::Move(int32 InFromIndex, int32 InToIndex)
+{
+	const int32 Step = InFromIndex < InToIndex ? 1 : -1;
+	const float MovedHeight = Heights[InFromIndex];
+
+	for (int32 Index = InFromIndex; Index != InToIndex; Index += Step)
+	{
+		SetHeight(Index, Heights[Index + Step]);
+	}
+
+	SetHeight(InToIndex, MovedHeight);
+}
+
+void FIndexedListOffsetIndex::Build()
+{
+	const int32 Count = Num();
+	Tree.SetNumUninitialized(Count + 1);
+	Tree[0] = 0.0;
+
+	for (int32 Node = 1; Node <= Count; ++Node)
+	{
+		Tree[Node] = Heights[Node - 1];
+	}
+
+	for (int32 Node = 1; Node <= Count; ++Node)
+	{
+		const int32 Parent = Node + IndexedListOffsetIndex::LowBit(Node);
+		if (Parent <= Count)
+		{
+			Tree[Parent] += Tree[Node];
+		}
+	}
+}
+
+void FIndexedListOffsetIndex::Append(float InHeight)
+{
+	if (Tree.Num() == 0)
+	{
+		Tree.Add(0.0);
+	}
+
+	const int32 Node = Num() + 1;
+	Heights.Add(InHeight);
+
+	// The new node covers (Node - LowBit(Node), Node], the rows before it are already summed by the tree.
+	const double Covered = GetOffset(Node - 1) - GetOffset(Node - IndexedListOffsetIndex::LowBit(Node));
+	Tree.Add(Covered + InHeight);
+}
+
+void FIndexedListOffsetIndex::AddDelta(int32 InIndex, double InDelta)
+{
+	for (int32 Node = InIndex + 1; Node <= Num(); Node += IndexedListOffsetIndex::LowBit(Node))
+	{
+		Tree[Node] += InDelta;
+	}
+}
@@ -0,0 +1,379 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListContainer/IndexedListPagedDataSource.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogIndexedListDataSource, Log, All);
+
+UObject* UIndexedListPagedDataSource::GetRow(int32 InIndex)
+{
+	if (InIndex < 0)
+	{
+		return nullptr;
+	}
+
+	FIndexedListPage* Page = Pages.Find(InIndex / PageSize);
+	if (!Page)
+	{
+		return nullptr;
+	}
+
+	Page->LastAccess = ++AccessCounter;
+	const int32 RowInPage = InIndex % PageSize;
+	return Page->Rows.IsValidIndex(RowInPage) ? Page->Rows[RowInPage] : nullptr;
+}
+
+bool UIndexedListPagedDataSource::IsRowLoaded(int32 InIndex) const
+{
+	return InIndex >= 0 && Pages.Contains(InIndex / PageSize);
+}
+
+void UIndexedListPagedDataSource::NotifyVisibleRange(int32 InFirstIndex, int32 InEndIndex, int32 InTotalCount, int32 InScrollDirection)
+{
+	TotalCount = InTotalCount;
+	PinnedPages.Reset();
+	if (InFirstIndex >= InEndIndex || TotalCount <= 0)
+	{
+		return;
+	}
+
+	if (InScrollDirection != 0)
+	{
+		ScrollDirection = InScrollDirection > 0 ? 1 : -1;
+	}
+
+	const int32 LastPage = (TotalCount - 1) / PageSize;
+	const int32 FirstVisiblePage = InFirstIndex / PageSize;
+	const int32 LastVisiblePage = (InEndIndex - 1) / PageSize;
+
+	for (int32 PageIndex = FirstVisiblePage; PageIndex <= LastVisiblePage; ++PageIndex)
+	{
+		PinPage(PageIndex);
+	}
+
+	for (int32 Step = 1; Step <= PrefetchPages; ++Step)
+	{
+		const int32 PageIndex = ScrollDirection > 0 ? LastVisiblePage + Step : FirstVisiblePage - Step;
+		if (PageIndex < 0 || PageIndex > LastPage)
+		{
+			break;
+		}
+
+		PinPage(PageIndex);
+	}
+}
+
+void UIndexedListPagedDataSource::NotifyVisibleItems(TConstArrayView<int32> InVisibleItems, TConstArrayView<int32> InPrefetchItems, int32 InTotalCount)
+{
+	TotalCount = InTotalCount;
+	PinnedPages.Reset();
+	if (TotalCount <= 0)
+	{
+		return;
+	}
+
+	for (const int32 Index : InVisibleItems)
+	{
+		if (Index >= 0 && Index < TotalCount)
+		{
+			PinPage(Index / PageSize);
+		}
+	}
+
+	int32 PrefetchedPages = 0;
+	for (const int32 Index : InPrefetchItems)
+	{
+		if (PrefetchedPages >= PrefetchPages)
+		{
+			break;
+		}
+
+		if (Index >= 0 && Index < TotalCount && !PinnedPages.Contains(Index / PageSize))
+		{
+			PinPage(Index / PageSize);
+			++PrefetchedPages;
+		}
+	}
+}
+
+void UIndexedListPagedDataSource::FulfillPage(int32 InPageIndex, int32 InRequestId, const TArray<UObject*>& InRows, int64 InEstimatedBytes)
+{
+	if (!CompletePendingRequest(InPageIndex, InRequestId))
+	{
+		return;
+	}
+
+	FailedAttempts.Remove(InPageIndex);
+
+	FIndexedListPage& Page = Pages.Add(InPageIndex);
+	Page.Rows = InRows;
+	Page.Bytes = InEstimatedBytes > 0 ? InEstimatedBytes : EstimateRowsBytes(InRows);
+	Page.LastAccess = ++AccessCounter;
+	CachedBytes += Page.Bytes;
+
+	EvictToBudget();
+
+	OnPageLoaded.Broadcast(InPageIndex * PageSize, InRows.Num());
+}
+
+void UIndexedListPagedDataSource::FailPage(int32 InPageIndex, int32 InRequestId)
+{
+	if (!CompletePendingRequest(InPageIndex, InRequestId))
+	{
+		return;
+	}
+
+	int32& Attempts = FailedAttempts.FindOrAdd(InPageIndex);
+	++Attempts;
+
+	if (Attempts > MaxRetries)
+	{
+		// Kept as failed, otherwise the next visible range update would request it again right away.
+		UE_LOG(LogIndexedListDataSource, Warning, TEXT("Page %d failed to load, giving up after %d retries"), InPageIndex, MaxRetries);
+		return;
+	}
+
+	const float Delay = RetryDelay * static_cast<float>(1 << FMath::Min(Attempts - 1, 16));
+	UE_LOG(LogIndexedListDataSource, Warning, TEXT("Page %d failed to load, retrying in %.2fs"), InPageIndex, Delay);
+
+	TWeakObjectPtr<UIndexedListPagedDataSource> WeakThis(this);
+	RetryTickers.Add(InPageIndex, FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[WeakThis, InPageIndex](float)
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->RetryPage(InPageIndex);
+			}
+			return false;
+		}), Delay));
+}
+
+void UIndexedListPagedDataSource::RetryFailedPages()
+{
+	for (auto It = FailedAttempts.CreateIterator(); It; ++It)
+	{
+		if (It.Value() > MaxRetries)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const int32 PageIndex : PinnedPages)
+	{
+		EnsurePageRequested(PageIndex);
+	}
+}
+
+void UIndexedListPagedDataSource::Reset()
+{
+	CancelRetries();
+	Pages.Empty();
+	PendingPages.Empty();
+	FailedAttempts.Empty();
+	PinnedPages.Empty();
+	CachedBytes = 0;
+}
+
+void UIndexedListPagedDataSource::InvalidateRange(int32 InFirstIndex, int32 InEndIndex)
+{
+	if (InFirstIndex >= InEndIndex)
+	{
+		return;
+	}
+
+	const int32 FirstPage = FMath::Max(InFirstIndex, 0) / PageSize;
+	const int32 LastPage = (InEndIndex - 1) / PageSize;
+	const auto Overlaps = [FirstPage, LastPage](int32 PageIndex)
+	{
+		return PageIndex >= FirstPage && PageIndex <= LastPage;
+	};
+
+	for (auto It = Pages.CreateIterator(); It; ++It)
+	{
+		if (Overlaps(It.Key()))
+		{
+			CachedBytes -= It.Value().Bytes;
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = PendingPages.CreateIterator(); It; ++It)
+	{
+		if (Overlaps(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = RetryTickers.CreateIterator(); It; ++It)
+	{
+		if (Overlaps(It.Key()))
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = FailedAttempts.CreateIterator(); It; ++It)
+	{
+		if (Overlaps(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int32 UIndexedListPagedDataSource::GetPageSize() const noexcept
+{
+	return PageSize;
+}
+
+int32 UIndexedListPagedDataSource::GetPrefetchPages() const noexcept
+{
+	return PrefetchPages;
+}
+
+int64 UIndexedListPagedDataSource::GetCachedBytes() const noexcept
+{
+	return CachedBytes;
+}
+
+int32 UIndexedListPagedDataSource::GetNumCachedPages() const noexcept
+{
+	return Pages.Num();
+}
+
+void UIndexedListPagedDataSource::BeginDestroy()
+{
+	CancelRetries();
+
+	Super::BeginDestroy();
+}
+
+void UIndexedListPagedDataSource::RequestPage_Implementation(int32 InPageIndex, int32 InFirstIndex, int32 InCount, int32 InRequestId)
+{
+	UE_LOG(LogIndexedListDataSource, Warning, TEXT("[%s] does not implement RequestPage"), *GetNameSafe(GetClass()));
+	FailPage(InPageIndex, InRequestId);
+}
+
+void UIndexedListPagedDataSource::EnsurePageRequested(int32 InPageIndex)
+{
+	// Failed pages wait for their backoff instead of being requested again on every visible range update,
+	// and pages out of retries wait for RetryFailedPages or InvalidateRange.
+	if (Pages.Contains(InPageIndex) || PendingPages.Contains(InPageIndex) || RetryTickers.Contains(InPageIndex)
+		|| FailedAttempts.FindRef(InPageIndex) > MaxRetries)
+	{
+		return;
+	}
+
+	const int32 FirstIndex = InPageIndex * PageSize;
+	const int32 Count = FMath::Min(PageSize, TotalCount - FirstIndex);
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	// Zero is skipped, so Blueprint callers passing an unset id never match a request.
+	const int32 RequestId = ++LastRequestId != 0 ? LastRequestId : ++LastRequestId;
+	PendingPages.Add(InPageIndex, RequestId);
+	RequestPage(InPageIndex, FirstIndex, Count, RequestId);
+}
+
+bool UIndexedListPagedDataSource::CompletePendingRequest(int32 InPageIndex, int32 InRequestId)
+{
+	// A page dropped by InvalidateRange and requested again is pending under a newer id, its old response is stale.
+	const int32* PendingRequestId = PendingPages.Find(InPageIndex);
+	if (!PendingRequestId || *PendingRequestId != InRequestId)
+	{
+		UE_LOG(LogIndexedListDataSource, Verbose, TEXT("Ignoring response %d for page %d that is no longer pending"), InRequestId, InPageIndex);
+		return false;
+	}
+
+	PendingPages.Remove(InPageIndex);
+	return true;
+}
+
+void UIndexedListPagedDataSource::PinPage(int32 InPageIndex)
+{
+	bool bAlreadyPinned = false;
+	PinnedPages.Add(InPageIndex, &bAlreadyPinned);
+	if (bAlreadyPinned)
+	{
+		return;
+	}
+
+	EnsurePageRequested(InPageIndex);
+	if (FIndexedListPage* Page = Pages.Find(InPageIndex))
+	{
+		Page->LastAccess = ++AccessCounter;
+	}
+}
+
+void UIndexedListPagedDataSource::RetryPage(int32 InPageIndex)
+{
+	RetryTickers.Remove(InPageIndex);
+
+	// Pages scrolled away are requested again, with a fresh count, once they become visible.
+	if (!IsPagePinned(InPageIndex))
+	{
+		FailedAttempts.Remove(InPageIndex);
+		return;
+	}
+
+	EnsurePageRequested(InPageIndex);
+}
+
+void UIndexedListPagedDataSource::CancelRetries()
+{
+	for (const auto& Pair : RetryTickers)
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(Pair.Value);
+	}
+	RetryTickers.Empty();
+}
+
+bool UIndexedListPagedDataSource::IsPagePinned(int32 InPageIndex) const
+{
+	return PinnedPages.Contains(InPageIndex);
+}
+
+void UIndexedListPagedDataSource::EvictToBudget()
+{
+	// Linear in cached pages, which the byte budget keeps small.
+	while (CachedBytes > MaxCachedBytes)
+	{
+		int32 OldestPage = INDEX_NONE;
+		uint64 OldestAccess = MAX_uint64;
+
+		for (const auto& Pair : Pages)
+		{
+			if (!IsPagePinned(Pair.Key) && Pair.Value.LastAccess < OldestAccess)
+			{
+				OldestPage = Pair.Key;
+				OldestAccess = Pair.Value.LastAccess;
+			}
+		}
+
+		if (OldestPage == INDEX_NONE)
+		{
+			return;
+		}
+
+		CachedBytes -= Pages.FindChecked(OldestPage).Bytes;
+		Pages.Remove(OldestPage);
+	}
+}
+
+int64 UIndexedListPagedDataSource::EstimateRowsBytes(const TArray<UObject*>& InRows)
+{
+	int64 Bytes = InRows.GetAllocatedSize();
+	for (const UObject* Row : InRows)
+	{
+		if (IsValid(Row))
+		{
+			Bytes += Row->GetClass()->GetStructureSize();
+		}
+	}
+
+	return Bytes;
+}
@@ -0,0 +1,307 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListContainer/IndexedListSelection.h"
+
+bool FIndexedListSelection::Contains(int32 InIndex) const
+{
+	const int32 RangeIndex = LowerBound(InIndex);
+	return Ranges.IsValidIndex(RangeIndex) && Ranges[RangeIndex].Start <= InIndex;
+}
+
+bool FIndexedListSelection::Add(int32 InStart, int32 InEnd)
+{
+	if (InStart >= InEnd)
+	{
+		return false;
+	}
+
+	// Ranges touching the new one are merged with it, adjacent ones included.
+	const int32 First = LowerBound(InStart - 1);
+	int32 Last = First;
+	FRange Merged{InStart, InEnd};
+	int32 MergedCount = 0;
+
+	while (Last < Ranges.Num() && Ranges[Last].Start <= InEnd)
+	{
+		Merged.Start = FMath::Min(Merged.Start, Ranges[Last].Start);
+		Merged.End = FMath::Max(Merged.End, Ranges[Last].End);
+		MergedCount += Ranges[Last].Num();
+		++Last;
+	}
+
+	if (Last - First == 1 && Ranges[First].Start == Merged.Start && Ranges[First].End == Merged.End)
+	{
+		return false;
+	}
+
+	Ranges.RemoveAt(First, Last - First, EAllowShrinking::No);
+	Ranges.Insert(Merged, First);
+	SelectedCount += Merged.Num() - MergedCount;
+	return true;
+}
+
+bool FIndexedListSelection::Remove(int32 InStart, int32 InEnd)
+{
+	if (InStart >= InEnd)
+	{
+		return false;
+	}
+
+	const int32 First = LowerBound(InStart);
+	int32 Last = First;
+	while (Last < Ranges.Num() && Ranges[Last].Start < InEnd)
+	{
+		++Last;
+	}
+
+	if (First == Last)
+	{
+		return false;
+	}
+
+	const FRange Left{Ranges[First].Start, InStart};
+	const FRange Right{InEnd, Ranges[Last - 1].End};
+
+	for (int32 RangeIndex = First; RangeIndex < Last; ++RangeIndex)
+	{
+		SelectedCount -= Ranges[RangeIndex].Num();
+	}
+	Ranges.RemoveAt(First, Last - First, EAllowShrinking::No);
+
+	int32 InsertAt = First;
+	if (Left.Num() > 0)
+	{
+		Ranges.Insert(Left, InsertAt++);
+		SelectedCount += Left.Num();
+	}
+	if (Right.Num() > 0)
+	{
+		Ranges.Insert(Right, InsertAt);
+		SelectedCount += Right.Num();
+	}
+
+	return true;
+}
+
+bool FIndexedListSelection::Toggle(int32 InIndex)
+{
+	if (Contains(InIndex))
+	{
+		Remove(InIndex, InIndex + 1);
+		return false;
+	}
+
+	Add(InIndex, InIndex + 1);
+	return true;
+}
+
+void FIndexedListSelection::SelectAll(int32 InCount)
+{
+	Ranges.Reset();
+	SelectedCount = 0;
+
+	if (InCount > 0)
+	{
+		Ranges.Add({0, InCount});
+		SelectedCount = InCount;
+	}
+}
+
+void FIndexedListSelection::Invert(int32 InCount)
+{
+	TArray<FRange> Inverted;
+	Inverted.Reserve(Ranges.Num() + 1);
+	SelectedCount = 0;
+
+	int32 Cursor = 0;
+	for (const FRange& Range : Ranges)
+	{
+		if (Range.Start >= InCount)
+		{
+			break;
+		}
+
+		if (Range.Start > Cursor)
+		{
+			Inverted.Add({Cursor, Range.Start});
+			SelectedCount += Range.Start - Cursor;
+		}
+		Cursor = Range.End;
+	}
+
+	if (Cursor < InCount)
+	{
+		Inverted.Add({Cursor, InCount});
+		SelectedCount += InCount - Cursor;
+	}
+
+	Ranges = MoveTemp(Inverted);
+}
+
+void FIndexedListSelection::InvertRange(int32 InStart, int32 InEnd)
+{
+	if (InStart >= InEnd)
+	{
+		return;
+	}
+
+	const int32 First = LowerBound(InStart);
+	int32 Last = First;
+	while (Last < Ranges.Num() && Ranges[Last].Start < InEnd)
+	{
+		++Last;
+	}
+
+	// Parts outside the window survive, the gaps inside it become selected.
+	TArray<FRange> Pieces;
+	int32 Cursor = InStart;
+	for (int32 RangeIndex = First; RangeIndex < Last; ++RangeIndex)
+	{
+		const FRange& Range = Ranges[RangeIndex];
+		if (Range.Start < InStart)
+		{
+			Pieces.Add({Range.Start, InStart});
+		}
+		if (Range.End > InEnd)
+		{
+			Pieces.Add({InEnd, Range.End});
+		}
+
+		const int32 ClippedStart = FMath::Max(Range.Start, InStart);
+		if (ClippedStart > Cursor)
+		{
+			Pieces.Add({Cursor, ClippedStart});
+		}
+
+		Cursor = FMath::Min(Range.End, InEnd);
+		SelectedCount -= Range.Num();
+	}
+
+	if (Cursor < InEnd)
+	{
+		Pieces.Add({Cursor, InEnd});
+	}
+
+	Ranges.RemoveAt(First, Last - First, EAllowShrinking::No);
+	for (const FRange& Piece : Pieces)
+	{
+		Add(Piece.Start, Piece.End);
+	}
+}
+
+void FIndexedListSelection::Empty()
+{
+	Ranges.Reset();
+	SelectedCount = 0;
+}
+
+void FIndexedListSelection::InsertGap(int32 InIndex, int32 InCount)
+{
+	if (InCount <= 0)
+	{
+		return;
+	}
+
+	for (int32 RangeIndex = LowerBound(InIndex); RangeIndex < Ranges.Num(); ++RangeIndex)
+	{
+		FRange& Range = Ranges[RangeIndex];
+		if (Range.Start >= InIndex)
+		{
+			Range.Start += InCount;
+			Range.End += InCount;
+			continue;
+		}
+
+		// The gap lands inside this range, split it around the new unselected items.
+		const FRange Tail{InIndex + InCount, Range.End + InCount};
+		Range.End = InIndex;
+		Ranges.Insert(Tail, ++RangeIndex);
+	}
+}
+
+void FIndexedListSelection::Collapse(int32 InIndex, int32 InCount)
+{
+	if (InCount <= 0)
+	{
+		return;
+	}
+
+	Remove(InIndex, InIndex + InCount);
+
+	const int32 First = LowerBound(InIndex);
+	for (int32 RangeIndex = First; RangeIndex < Ranges.Num(); ++RangeIndex)
+	{
+		Ranges[RangeIndex].Start -= InCount;
+		Ranges[RangeIndex].End -= InCount;
+	}
+
+	// Ranges on both sides of the removed items may now touch.
+	if (First > 0 && Ranges.IsValidIndex(First) && Ranges[First - 1].End == Ranges[First].Start)
+	{
+		Ranges[First - 1].End = Ranges[First].End;
+		Ranges.RemoveAt(First, 1, EAllowShrinking::No);
+	}
+}
+
+void FIndexedListSelection::Move(int32 InFromIndex, int32 InToIndex)
+{
+	const bool bWasSelected = Contains(InFromIndex);
+	Collapse(InFromIndex, 1);
+	InsertGap(InToIndex, 1);
+
+	if (bWasSelected)
+	{
+		Add(InToIndex, InToIndex + 1);
+	}
+}
+
+void FIndexedListSelection::GetIndices(TArray<int32>& OutIndices) const
+{
+	OutIndices.Reset(SelectedCount);
+	for (const FRange& Range : Ranges)
+	{
+		for (int32 Index = Range.Start; Index < Range.End; ++Index)
+		{
+			OutIndices.Add(Index);
+		}
+	}
+}
+
+bool FIndexedListSelection::operator==(const FIndexedListSelection& Other) const
+{
+	if (SelectedCount != Other.SelectedCount || Ranges.Num() != Other.Ranges.Num())
+	{
+		return false;
+	}
+
+	for (int32 RangeIndex = 0; RangeIndex < Ranges.Num(); ++RangeIndex)
+	{
+		if (Ranges[RangeIndex].Start != Other.Ranges[RangeIndex].Start || Ranges[RangeIndex].End != Other.Ranges[RangeIndex].End)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int32 FIndexedListSelection::LowerBound(int32 InIndex) const
+{
+	int32 Low = 0;
+	int32 High = Ranges.Num();
+	while (Low < High)
+	{
+		const int32 Middle = Low + (High - Low) / 2;
+		if (Ranges[Middle].End > InIndex)
+		{
+			High = Middle;
+		}
+		else
+		{
+			Low = Middle + 1;
+		}
+	}
+
+	return Low;
+}
@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListContainer/IndexedListTypeaheadIndex.h"
+
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+
+TSharedRef<const FIndexedListTypeaheadIndex, ESPMode::ThreadSafe> FIndexedListTypeaheadIndex::Build(TArray<FString>&& InKeys)
+{
+	TSharedRef<FIndexedListTypeaheadIndex, ESPMode::ThreadSafe> Index = MakeShared<FIndexedListTypeaheadIndex, ESPMode::ThreadSafe>();
+	Index->Entries.Reserve(InKeys.Num());
+
+	for (int32 ItemIndex = 0; ItemIndex < InKeys.Num(); ++ItemIndex)
+	{
+		FString& Key = InKeys[ItemIndex];
+		Key.ToLowerInline();
+		Index->Entries.Add({MoveTemp(Key), ItemIndex});
+	}
+
+	// Equal keys stay in item order, so the first match is the earliest item.
+	Algo::Sort(Index->Entries, [](const FEntry& A, const FEntry& B)
+	{
+		const int32 Compare = A.Key.Compare(B.Key, ESearchCase::CaseSensitive);
+		return Compare != 0 ? Compare < 0 : A.ItemIndex < B.ItemIndex;
+	});
+
+	return Index;
+}
+
+int32 FIndexedListTypeaheadIndex::FindFirstWithPrefix(const FString& InPrefix) const
+{
+	const FString Prefix = InPrefix.ToLower();
+	const int32 Position = Algo::LowerBoundBy(Entries, Prefix, &FEntry::Key, [](const FString& A, const FString& B)
+	{
+		return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+	});
+
+	return Entries.IsValidIndex(Position) && HasPrefix(Position, Prefix) ? Position : INDEX_NONE;
+}
+
+bool FIndexedListTypeaheadIndex::HasPrefix(int32 InPosition, const FString& InPrefix) const
+{
+	return Entries[InPosition].Key.StartsWith(InPrefix, ESearchCase::IgnoreCase);
+}
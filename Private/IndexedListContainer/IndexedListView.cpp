@@ -0,0 +1,188 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListContainer/IndexedListView.h"
+
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+#include "Tasks/Task.h"
+
+namespace IndexedListView
+{
+	constexpr int32 FilterChunkSize = 4096;
+	constexpr int32 MinSortChunkSize = 2048;
+
+	void ParallelFilter(int32 InNumItems, const TFunction<bool(int32)>& InFilter, TArray<int32>& OutRows)
+	{
+		if (!InFilter)
+		{
+			OutRows.SetNumUninitialized(InNumItems);
+			for (int32 Index = 0; Index < InNumItems; ++Index)
+			{
+				OutRows[Index] = Index;
+			}
+			return;
+		}
+
+		const int32 NumChunks = FMath::DivideAndRoundUp(InNumItems, FilterChunkSize);
+		TArray<TArray<int32>> ChunkRows;
+		ChunkRows.SetNum(NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 Start = Chunk * FilterChunkSize;
+			const int32 End = FMath::Min(Start + FilterChunkSize, InNumItems);
+			TArray<int32>& Rows = ChunkRows[Chunk];
+			Rows.Reserve(End - Start);
+
+			for (int32 Index = Start; Index < End; ++Index)
+			{
+				if (InFilter(Index))
+				{
+					Rows.Add(Index);
+				}
+			}
+		});
+
+		int32 NumRows = 0;
+		for (const TArray<int32>& Rows : ChunkRows)
+		{
+			NumRows += Rows.Num();
+		}
+
+		OutRows.Reset(NumRows);
+		for (const TArray<int32>& Rows : ChunkRows)
+		{
+			OutRows.Append(Rows);
+		}
+	}
+
+	void ParallelStableSort(TArray<int32>& InOutRows, const TFunction<bool(int32, int32)>& InLess)
+	{
+		const int32 Num = InOutRows.Num();
+		const int32 MaxChunks = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+		const int32 NumChunks = FMath::Clamp(Num / MinSortChunkSize, 1, MaxChunks);
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 Start = Chunk * ChunkSize;
+			const int32 Count = FMath::Min(ChunkSize, Num - Start);
+			if (Count > 1)
+			{
+				Algo::StableSort(TArrayView<int32>(InOutRows.GetData() + Start, Count), InLess);
+			}
+		});
+
+		// Merge sorted runs pairwise, each level in parallel, until a single run is left.
+		TArray<int32> Buffer;
+		Buffer.SetNumUninitialized(Num);
+
+		for (int32 Width = ChunkSize; Width < Num; Width *= 2)
+		{
+			const int32 NumPairs = FMath::DivideAndRoundUp(Num, Width * 2);
+			const int32* Source = InOutRows.GetData();
+			int32* Target = Buffer.GetData();
+
+			ParallelFor(NumPairs, [&](int32 Pair)
+			{
+				const int32 Low = Pair * Width * 2;
+				const int32 Middle = FMath::Min(Low + Width, Num);
+				const int32 High = FMath::Min(Low + Width * 2, Num);
+
+				int32 Left = Low;
+				int32 Right = Middle;
+				int32 Out = Low;
+				while (Left < Middle && Right < High)
+				{
+					Target[Out++] = InLess(Source[Right], Source[Left]) ? Source[Right++] : Source[Left++];
+				}
+				while (Left < Middle)
+				{
+					Target[Out++] = Source[Left++];
+				}
+				while (Right < High)
+				{
+					Target[Out++] = Source[Right++];
+				}
+			});
+
+			Swap(InOutRows, Buffer);
+		}
+	}
+
+	TSharedRef<const FIndexedListViewPermutation, ESPMode::ThreadSafe> Build(int32 InNumItems, const FIndexedListViewDesc& InDesc)
+	{
+		TSharedRef<FIndexedListViewPermutation, ESPMode::ThreadSafe> View = MakeShared<FIndexedListViewPermutation, ESPMode::ThreadSafe>();
+		const int32 NumItems = FMath::Max(InNumItems, 0);
+
+		ParallelFilter(NumItems, InDesc.Filter, View->RowToItem);
+
+		if (InDesc.Less && View->RowToItem.Num() > 1)
+		{
+			ParallelStableSort(View->RowToItem, InDesc.Less);
+		}
+
+		View->ItemToRow.Init(INDEX_NONE, NumItems);
+		const TArray<int32>& RowToItem = View->RowToItem;
+		TArray<int32>& ItemToRow = View->ItemToRow;
+
+		ParallelFor(FMath::DivideAndRoundUp(RowToItem.Num(), FilterChunkSize), [&](int32 Chunk)
+		{
+			const int32 Start = Chunk * FilterChunkSize;
+			const int32 End = FMath::Min(Start + FilterChunkSize, RowToItem.Num());
+			for (int32 Row = Start; Row < End; ++Row)
+			{
+				ItemToRow[RowToItem[Row]] = Row;
+			}
+		});
+
+		return View;
+	}
+}
+
+FIndexedListViewBuilder::FIndexedListViewBuilder()
+	: State(MakeShared<FState, ESPMode::ThreadSafe>())
+{
+}
+
+void FIndexedListViewBuilder::Request(int32 InNumItems, const FIndexedListViewDesc& InDesc)
+{
+	const uint32 Generation = ++State->LatestGeneration;
+	++State->NumInFlight;
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [State = State, Generation, InNumItems, Desc = InDesc]()
+	{
+		if (State->LatestGeneration == Generation)
+		{
+			const auto View = IndexedListView::Build(InNumItems, Desc);
+
+			FScopeLock ScopeLock(&State->Lock);
+			if (State->LatestGeneration == Generation)
+			{
+				State->Completed = View;
+			}
+		}
+
+		--State->NumInFlight;
+	});
+}
+
+void FIndexedListViewBuilder::Cancel()
+{
+	++State->LatestGeneration;
+
+	FScopeLock ScopeLock(&State->Lock);
+	State->Completed.Reset();
+}
+
+bool FIndexedListViewBuilder::IsBuilding() const
+{
+	return State->NumInFlight > 0;
+}
+
+TSharedPtr<const FIndexedListViewPermutation, ESPMode::ThreadSafe> FIndexedListViewBuilder::ConsumeCompleted()
+{
+	FScopeLock ScopeLock(&State->Lock);
+	return MoveTemp(State->Completed);
+}
@@ -3,7 +3,1642 @@
 
 #include "IndexedListContainer/UMG/IndexedListContainer.h"
 
+#include "Algo/StableSort.h"
+#include "Components/CanvasPanel.h"
+#include "Components/CanvasPanelSlot.h"
+#include "IndexedListContainer/IndexedListPagedDataSource.h"
+#include "IndexedListContainer/UMG/IndexedListEntryInterface.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Editor/WidgetCompilerLog.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogIndexedListContainer, Log, All);
+
+static TAutoConsoleVariable<float> CVarIndexedListEntryBuildBudgetMs(
+	TEXT("IndexedList.EntryBuildBudgetMs"),
+	0.f,
+	TEXT("Milliseconds per frame each IndexedListContainer may spend building entries. 0 builds every entry in one frame."));
+
+namespace IndexedListContainer
+{
+	/** Adds unordered, unique items to the selection as runs of consecutive indices. */
+	void AddItemRuns(FIndexedListSelection& OutSelection, TArray<int32>& InItems)
+	{
+		InItems.Sort();
+
+		int32 RunStart = 0;
+		for (int32 Index = 1; Index <= InItems.Num(); ++Index)
+		{
+			if (Index == InItems.Num() || InItems[Index] != InItems[Index - 1] + 1)
+			{
+				OutSelection.Add(InItems[RunStart], InItems[Index - 1] + 1);
+				RunStart = Index;
+			}
+		}
+	}
+}
+
 void UIndexedListContainer::SelectItemAtIndex(int32 InIndex)
 {
-	OnIndexedListItemSelected.Broadcast(InIndex);
+	if (!IsValidItemIndex(InIndex))
+	{
+		UE_LOG(LogIndexedListContainer, Warning, TEXT("Invalid item index: %d"), InIndex);
+		return;
+	}
+
+	const bool bSelectionChanged = Selection.Num() != 1 || !Selection.Contains(InIndex);
+	if (bSelectionChanged)
+	{
+		Selection.Empty();
+		Selection.Add(InIndex, InIndex + 1);
+		RefreshLiveEntrySelection();
+	}
+
+	SelectedIndex = InIndex;
+
+	if (bScrollSelectionIntoView && IsVirtualized())
+	{
+		ScrollIndexIntoView(InIndex);
+	}
+
+	NotifyItemSelected(InIndex);
+
+	if (bSelectionChanged)
+	{
+		NotifySelectionChanged();
+	}
+}
+
+void UIndexedListContainer::ToggleItemSelection(int32 InIndex)
+{
+	if (!IsValidItemIndex(InIndex))
+	{
+		UE_LOG(LogIndexedListContainer, Warning, TEXT("Invalid item index: %d"), InIndex);
+		return;
+	}
+
+	if (!CanMultiSelect() && !Selection.Contains(InIndex))
+	{
+		SelectItemAtIndex(InIndex);
+		return;
+	}
+
+	const bool bSelected = Selection.Toggle(InIndex);
+	SelectedIndex = InIndex;
+	UpdateEntrySelection(InIndex, bSelected);
+	NotifySelectionChanged();
+}
+
+void UIndexedListContainer::SelectRange(int32 InFromIndex, int32 InToIndex, bool bInAppend)
+{
+	if (!CanMultiSelect() || ElementsCount == 0)
+	{
+		return;
+	}
+
+	FIndexedListSelection RangeSelection;
+	if (!ActiveView)
+	{
+		const int32 Start = FMath::Clamp(FMath::Min(InFromIndex, InToIndex), 0, ElementsCount - 1);
+		const int32 End = FMath::Clamp(FMath::Max(InFromIndex, InToIndex), 0, ElementsCount - 1) + 1;
+		RangeSelection.Add(Start, End);
+		ApplySelection(MoveTemp(RangeSelection), bInAppend);
+		return;
+	}
+
+	// The range spans rows of the view, which map to scattered items.
+	const int32 FromRow = GetRowForItemIndex(InFromIndex);
+	const int32 ToRow = GetRowForItemIndex(InToIndex);
+	if (FromRow == INDEX_NONE || ToRow == INDEX_NONE)
+	{
+		UE_LOG(LogIndexedListContainer, Warning, TEXT("Range %d -> %d is not shown by the view"), InFromIndex, InToIndex);
+		return;
+	}
+
+	const int32 FirstRow = FMath::Min(FromRow, ToRow);
+	TArray<int32> Items(ActiveView->RowToItem.GetData() + FirstRow, FMath::Max(FromRow, ToRow) - FirstRow + 1);
+	IndexedListContainer::AddItemRuns(RangeSelection, Items);
+	ApplySelection(MoveTemp(RangeSelection), bInAppend);
+}
+
+void UIndexedListContainer::ExtendSelectionToIndex(int32 InIndex, bool bInAppend)
+{
+	const int32 Anchor = SelectedIndex != INDEX_NONE ? SelectedIndex : InIndex;
+	SelectRange(Anchor, InIndex, bInAppend);
+}
+
+void UIndexedListContainer::SelectAll()
+{
+	if (!CanMultiSelect())
+	{
+		return;
+	}
+
+	// With a view only the rows it shows are selected.
+	FIndexedListSelection AllSelection;
+	if (ActiveView)
+	{
+		TArray<int32> Items = ActiveView->RowToItem;
+		IndexedListContainer::AddItemRuns(AllSelection, Items);
+	}
+	else
+	{
+		AllSelection.SelectAll(ElementsCount);
+	}
+
+	ApplySelection(MoveTemp(AllSelection), false);
+}
+
+void UIndexedListContainer::InvertSelection()
+{
+	if (!CanMultiSelect() || ElementsCount == 0)
+	{
+		return;
+	}
+
+	if (ActiveView)
+	{
+		// Items filtered out of the view keep their selection state.
+		FIndexedListSelection ShownItems;
+		TArray<int32> Items = ActiveView->RowToItem;
+		IndexedListContainer::AddItemRuns(ShownItems, Items);
+
+		for (const FIndexedListSelection::FRange& Range : ShownItems.GetRanges())
+		{
+			Selection.InvertRange(Range.Start, Range.End);
+		}
+	}
+	else
+	{
+		Selection.Invert(ElementsCount);
+	}
+
+	RefreshLiveEntrySelection();
+	NotifySelectionChanged();
+}
+
+void UIndexedListContainer::ClearSelection()
+{
+	SelectedIndex = INDEX_NONE;
+	if (Selection.IsEmpty())
+	{
+		return;
+	}
+
+	Selection.Empty();
+	RefreshLiveEntrySelection();
+	NotifySelectionChanged();
+}
+
+bool UIndexedListContainer::IsItemSelected(int32 InIndex) const
+{
+	return Selection.Contains(InIndex);
+}
+
+int32 UIndexedListContainer::GetSelectedCount() const noexcept
+{
+	return Selection.Num();
+}
+
+TArray<int32> UIndexedListContainer::GetSelectedIndices() const
+{
+	TArray<int32> Indices;
+	Selection.GetIndices(Indices);
+	return Indices;
+}
+
+const FIndexedListSelection& UIndexedListContainer::GetSelection() const noexcept
+{
+	return Selection;
+}
+
+void UIndexedListContainer::FlushSelectionEvents()
+{
+	if (EndFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+
+	// Listeners may select again while being notified, those selections go to the next flush.
+	const TArray<int32> SelectedIndices = MoveTemp(PendingSelectedIndices);
+	const bool bSelectionChanged = bPendingSelectionChanged;
+	PendingSelectedIndices.Reset();
+	bPendingSelectionChanged = false;
+
+	for (const int32 Index : SelectedIndices)
+	{
+		OnIndexedListItemSelectedNative.Broadcast(Index);
+		OnIndexedListItemSelected.Broadcast(Index);
+	}
+
+	if (bSelectionChanged)
+	{
+		OnIndexedListSelectionChangedNative.Broadcast();
+		OnIndexedListSelectionChanged.Broadcast();
+	}
+}
+
+int32 UIndexedListContainer::GetSuppressedSelectionBroadcasts() const noexcept
+{
+	return SuppressedSelectionBroadcasts;
+}
+
+void UIndexedListContainer::ResetSuppressedSelectionBroadcasts()
+{
+	SuppressedSelectionBroadcasts = 0;
+}
+
+void UIndexedListContainer::SetElementsCount_Implementation(int32 InCount)
+{
+	ElementsCount = FMath::Max(InCount, 0);
+	bElementsCountSet = true;
+
+	if (ActiveView)
+	{
+		RemapView([this](int32 OldIndex)
+		{
+			return OldIndex < ElementsCount ? OldIndex : INDEX_NONE;
+		});
+	}
+
+	ResetRowOffsets();
+
+	if (SelectedIndex >= ElementsCount)
+	{
+		SelectedIndex = INDEX_NONE;
+	}
+
+	const bool bSelectionChanged = Selection.Remove(ElementsCount, MAX_int32);
+
+	RebindLiveEntries();
+
+	if (ViewDesc.IsSet())
+	{
+		RequestViewBuild();
+	}
+
+	OnElementsCountChanged(ElementsCount);
+
+	if (bSelectionChanged)
+	{
+		NotifySelectionChanged();
+	}
+}
+
+int32 UIndexedListContainer::GetElementsCount() const noexcept
+{
+	return ElementsCount;
+}
+
+void UIndexedListContainer::InsertRange(int32 InIndex, int32 InCount)
+{
+	if (InIndex < 0 || InIndex > ElementsCount || InCount <= 0)
+	{
+		UE_LOG(LogIndexedListContainer, Warning, TEXT("Invalid insert range: %d, %d"), InIndex, InCount);
+		return;
+	}
+
+	ElementsCount += InCount;
+	bElementsCountSet = true;
+	if (UsesRowOffsets() && !ActiveView)
+	{
+		// Seeded like ResetRowOffsets so inserted rows match the ones a rebuild would produce.
+		TArray<float> Heights;
+		Heights.SetNumUninitialized(InCount);
+		for (int32 Offset = 0; Offset < InCount; ++Offset)
+		{
+			Heights[Offset] = EstimateItemHeight(InIndex + Offset);
+		}
+
+		RowOffsets.Insert(InIndex, Heights);
+	}
+
+	Selection.InsertGap(InIndex, InCount);
+
+	RemapIndices([InIndex, InCount](int32 OldIndex)
+	{
+		return OldIndex >= InIndex ? OldIndex + InCount : OldIndex;
+	});
+
+	InvalidateDataSourceRange(InIndex, ElementsCount);
+
+	if (!IsVirtualized())
+	{
+		OnElementsCountChanged(ElementsCount);
+	}
+}
+
+void UIndexedListContainer::RemoveRange(int32 InIndex, int32 InCount)
+{
+	if (InIndex < 0 || InIndex >= ElementsCount || InCount <= 0)
+	{
+		UE_LOG(LogIndexedListContainer, Warning, TEXT("Invalid remove range: %d, %d"), InIndex, InCount);
+		return;
+	}
+
+	const int32 RemovedCount = FMath::Min(InCount, ElementsCount - InIndex);
+	const int32 RemovedEnd = InIndex + RemovedCount;
+
+	ElementsCount -= RemovedCount;
+	if (UsesRowOffsets() && !ActiveView)
+	{
+		RowOffsets.Remove(InIndex, RemovedCount);
+	}
+
+	const int32 PreviousSelectedCount = Selection.Num();
+	Selection.Collapse(InIndex, RemovedCount);
+
+	RemapIndices([InIndex, RemovedEnd, RemovedCount](int32 OldIndex)
+	{
+		if (OldIndex < InIndex)
+		{
+			return OldIndex;
+		}
+
+		return OldIndex >= RemovedEnd ? OldIndex - RemovedCount : INDEX_NONE;
+	});
+
+	InvalidateDataSourceRange(InIndex, ElementsCount + RemovedCount);
+
+	if (!IsVirtualized())
+	{
+		OnElementsCountChanged(ElementsCount);
+	}
+
+	if (Selection.Num() != PreviousSelectedCount)
+	{
+		NotifySelectionChanged();
+	}
+}
+
+void UIndexedListContainer::MoveItem(int32 InFromIndex, int32 InToIndex)
+{
+	if (InFromIndex < 0 || InFromIndex >= ElementsCount || InToIndex < 0 || InToIndex >= ElementsCount)
+	{
+		UE_LOG(LogIndexedListContainer, Warning, TEXT("Invalid move: %d -> %d"), InFromIndex, InToIndex);
+		return;
+	}
+
+	if (InFromIndex == InToIndex)
+	{
+		return;
+	}
+
+	if (UsesRowOffsets() && !ActiveView)
+	{
+		RowOffsets.Move(InFromIndex, InToIndex);
+	}
+
+	Selection.Move(InFromIndex, InToIndex);
+
+	RemapIndices([InFromIndex, InToIndex](int32 OldIndex)
+	{
+		if (OldIndex == InFromIndex)
+		{
+			return InToIndex;
+		}
+
+		if (InFromIndex < InToIndex && OldIndex > InFromIndex && OldIndex <= InToIndex)
+		{
+			return OldIndex - 1;
+		}
+
+		if (InToIndex < InFromIndex && OldIndex >= InToIndex && OldIndex < InFromIndex)
+		{
+			return OldIndex + 1;
+		}
+
+		return OldIndex;
+	});
+
+	InvalidateDataSourceRange(FMath::Min(InFromIndex, InToIndex), FMath::Max(InFromIndex, InToIndex) + 1);
+
+	if (!IsVirtualized())
+	{
+		OnElementsCountChanged(ElementsCount);
+	}
+}
+
+void UIndexedListContainer::UpdateRange(int32 InIndex, int32 InCount)
+{
+	const int32 EndIndex = FMath::Min(InIndex + InCount, ElementsCount);
+	for (auto It = LiveEntries.CreateIterator(); It; ++It)
+	{
+		const int32 ItemIndex = GetItemIndexForRow(It.Key());
+		if (ItemIndex < InIndex || ItemIndex >= EndIndex)
+		{
+			continue;
+		}
+
+		// Rows that switch between placeholder and real entry are re-acquired on the next refresh.
+		if (It.Value()->GetClass() != GetEntryClassForRow(It.Key()))
+		{
+			ReleaseEntry(It.Value());
+			It.RemoveCurrent();
+			bVirtualizationDirty = true;
+			continue;
+		}
+
+		BindEntry(It.Value(), It.Key());
+		MeasureEntry(It.Value(), It.Key());
+	}
+}
+
+int32 UIndexedListContainer::GetSelectedIndex() const noexcept
+{
+	return SelectedIndex;
+}
+
+void UIndexedListContainer::SetDataSource(UIndexedListPagedDataSource* InDataSource)
+{
+	if (IsValid(DataSource))
+	{
+		DataSource->OnPageLoaded.Remove(PageLoadedHandle);
+		PageLoadedHandle.Reset();
+	}
+
+	DataSource = InDataSource;
+
+	if (IsValid(DataSource))
+	{
+		PageLoadedHandle = DataSource->OnPageLoaded.AddUObject(this, &UIndexedListContainer::HandlePageLoaded);
+	}
+
+	UpdateRange(0, ElementsCount);
+	bVirtualizationDirty = true;
+}
+
+UIndexedListPagedDataSource* UIndexedListContainer::GetDataSource() const noexcept
+{
+	return DataSource;
+}
+
+UObject* UIndexedListContainer::GetItemObject(int32 InIndex) const
+{
+	if (!IsValid(DataSource) || InIndex < 0 || InIndex >= ElementsCount)
+	{
+		return nullptr;
+	}
+
+	return DataSource->GetRow(InIndex);
+}
+
+bool UIndexedListContainer::IsVirtualized() const noexcept
+{
+	return bVirtualize && IsValid(EntriesCanvas) && EntryWidgetClass != nullptr;
+}
+
+void UIndexedListContainer::RequestView(const FIndexedListViewDesc& InDesc)
+{
+	ViewDesc = InDesc;
+	RequestViewBuild();
+}
+
+void UIndexedListContainer::ClearView()
+{
+	ViewDesc.Reset();
+	ViewBuilder.Cancel();
+
+	if (BeginFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+		BeginFrameHandle.Reset();
+	}
+
+	if (ActiveView)
+	{
+		ApplyView(nullptr);
+	}
+}
+
+bool UIndexedListContainer::HasView() const noexcept
+{
+	return ActiveView.IsValid();
+}
+
+bool UIndexedListContainer::IsViewBuilding() const
+{
+	return ViewBuilder.IsBuilding();
+}
+
+int32 UIndexedListContainer::GetNumRows() const
+{
+	return ActiveView ? ActiveView->NumRows() : ElementsCount;
+}
+
+int32 UIndexedListContainer::GetItemIndexForRow(int32 InRow) const
+{
+	if (ActiveView)
+	{
+		return ActiveView->RowToItem.IsValidIndex(InRow) ? ActiveView->RowToItem[InRow] : INDEX_NONE;
+	}
+
+	return InRow >= 0 && InRow < ElementsCount ? InRow : INDEX_NONE;
+}
+
+int32 UIndexedListContainer::GetRowForItemIndex(int32 InIndex) const
+{
+	if (ActiveView)
+	{
+		return ActiveView->ItemToRow.IsValidIndex(InIndex) ? ActiveView->ItemToRow[InIndex] : INDEX_NONE;
+	}
+
+	return InIndex >= 0 && InIndex < ElementsCount ? InIndex : INDEX_NONE;
+}
+
+UUserWidget* UIndexedListContainer::GetEntryWidgetForIndex(int32 InIndex) const
+{
+	if (const auto Entry = LiveEntries.Find(GetRowForItemIndex(InIndex)))
+	{
+		return *Entry;
+	}
+
+	return nullptr;
+}
+
+void UIndexedListContainer::SetScrollOffset(double InScrollOffset)
+{
+	const double ClampedOffset = FMath::Clamp(InScrollOffset, 0.0, GetMaxScrollOffset());
+	if (ClampedOffset != ScrollOffset)
+	{
+		ScrollOffset = ClampedOffset;
+		bVirtualizationDirty = true;
+	}
+}
+
+double UIndexedListContainer::GetScrollOffset() const noexcept
+{
+	return ScrollOffset;
+}
+
+double UIndexedListContainer::GetContentExtent() const
+{
+	if (IsGridLayout())
+	{
+		return GridLayout.GetContentExtent(GetNumRows());
+	}
+
+	return GetRowOffset(GetNumRows());
+}
+
+int32 UIndexedListContainer::GetNumColumns() const
+{
+	return IsGridLayout() ? GridLayout.GetNumColumns() : 1;
+}
+
+void UIndexedListContainer::ScrollIndexIntoView(int32 InIndex)
+{
+	const int32 Row = GetRowForItemIndex(InIndex);
+	if (Row == INDEX_NONE)
+	{
+		return;
+	}
+
+	const double RowTop = GetRowOffset(Row);
+	const double RowBottom = RowTop + GetRowHeight(Row);
+
+	if (RowTop < ScrollOffset)
+	{
+		SetScrollOffset(RowTop);
+	}
+	else if (RowBottom > ScrollOffset + ViewportSize.Y)
+	{
+		SetScrollOffset(RowBottom - ViewportSize.Y);
+	}
+}
+
+void UIndexedListContainer::SetItemHeight(int32 InIndex, float InHeight)
+{
+	const int32 Row = GetRowForItemIndex(InIndex);
+	if (!UsesRowOffsets() || Row == INDEX_NONE || Row >= RowOffsets.Num())
+	{
+		return;
+	}
+
+	RefineRowHeight(Row, FMath::Max(InHeight, 0.f));
+}
+
+void UIndexedListContainer::SetTypeaheadKeys(TArray<FString> InKeys)
+{
+	PendingTypeaheadIndex = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Keys = MoveTemp(InKeys)]() mutable
+	{
+		return FIndexedListTypeaheadIndex::Build(MoveTemp(Keys));
+	});
+}
+
+int32 UIndexedListContainer::FindItemByPrefix(const FString& InPrefix)
+{
+	ConsumeTypeaheadIndex();
+	if (!TypeaheadIndex || InPrefix.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	// Keys are sorted alphabetically, not in view order, so every match is visited for the one shown first.
+	// Linear in the matches, which shrink with every typed character. Items filtered out of the view are skipped.
+	int32 FirstItemIndex = INDEX_NONE;
+	int32 FirstRow = MAX_int32;
+	for (int32 Position = TypeaheadIndex->FindFirstWithPrefix(InPrefix); Position != INDEX_NONE && Position < TypeaheadIndex->Num() && TypeaheadIndex->HasPrefix(Position, InPrefix); ++Position)
+	{
+		const int32 ItemIndex = TypeaheadIndex->GetItemIndex(Position);
+		const int32 Row = GetRowForItemIndex(ItemIndex);
+		if (Row != INDEX_NONE && Row < FirstRow)
+		{
+			FirstItemIndex = ItemIndex;
+			FirstRow = Row;
+			if (Row == 0)
+			{
+				break;
+			}
+		}
+	}
+
+	return FirstItemIndex;
+}
+
+void UIndexedListContainer::NavigateSelection(EIndexedListNavigation InNavigation)
+{
+	const int32 TargetRow = GetNavigationTargetRow(InNavigation);
+	if (TargetRow == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Scrolls the target into view when bScrollSelectionIntoView asks for it.
+	SelectItemAtIndex(GetItemIndexForRow(TargetRow));
+}
+
+void UIndexedListContainer::WarmUpEntries(int32 InCount, TSubclassOf<UUserWidget> InEntryClass)
+{
+	if (!IsValid(EntriesCanvas))
+	{
+		UE_LOG(LogIndexedListContainer, Warning, TEXT("Cannot warm up entries without EntriesCanvas"));
+		return;
+	}
+
+	EntryPool.WarmUp(this, EntriesCanvas, InEntryClass ? InEntryClass : EntryWidgetClass, InCount);
+}
+
+int32 UIndexedListContainer::GetEntryPoolHitCount() const noexcept
+{
+	return EntryPool.GetHitCount();
+}
+
+int32 UIndexedListContainer::GetEntryPoolMissCount() const noexcept
+{
+	return EntryPool.GetMissCount();
+}
+
+void UIndexedListContainer::ResetEntryPoolStats()
+{
+	EntryPool.ResetStats();
+}
+
+float UIndexedListContainer::GetEntryBuildBudgetMs() const
+{
+	return FMath::Max(bOverrideEntryBuildBudget ? EntryBuildBudgetMs : CVarIndexedListEntryBuildBudgetMs.GetValueOnGameThread(), 0.f);
+}
+
+bool UIndexedListContainer::AreVisibleEntriesMaterialized() const noexcept
+{
+	return bVisibleEntriesMaterialized;
+}
+
+#if WITH_EDITOR
+const FText UIndexedListContainer::GetPaletteCategory()
+{
+	return NSLOCTEXT("CommonBasicWidgets", "CommonBasicWidgets", "CommonBasicWidgets");
+}
+
+void UIndexedListContainer::ValidateCompiledDefaults(IWidgetCompilerLog& CompileLog) const
+{
+	Super::ValidateCompiledDefaults(CompileLog);
+
+	// SetElementsCount used to be an implementable event, Blueprints written against it override it without calling the parent.
+	const UFunction* SetElementsCountFunction = GetClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UIndexedListContainer, SetElementsCount));
+	if (SetElementsCountFunction && SetElementsCountFunction->GetOuterUClass() != UIndexedListContainer::StaticClass())
+	{
+		CompileLog.Warning(NSLOCTEXT("CommonBasicWidgets", "SetElementsCountOverridden",
+			"SetElementsCount is overridden. Handle OnElementsCountChanged instead, or call the parent, otherwise the element count, selection and virtualization are not updated."));
+	}
+}
+#endif
+
+float UIndexedListContainer::EstimateItemHeight(int32 InIndex) const
+{
+	return EntryHeight;
+}
+
+void UIndexedListContainer::NativePreConstruct()
+{
+	Super::NativePreConstruct();
+
+	// Tile settings only change through the designer, so they are applied before anything queries the grid.
+	UpdateGridLayout();
+}
+
+void UIndexedListContainer::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	// Key and character events only reach widgets that can take keyboard focus.
+	if (bEnableKeyboardNavigation || bEnableTypeahead)
+	{
+		SetIsFocusable(true);
+	}
+
+	if (IsValid(DataSource) && !PageLoadedHandle.IsValid())
+	{
+		PageLoadedHandle = DataSource->OnPageLoaded.AddUObject(this, &UIndexedListContainer::HandlePageLoaded);
+	}
+}
+
+void UIndexedListContainer::NativeDestruct()
+{
+	ReleaseAllEntries();
+	bVirtualizationDirty = true;
+
+	Super::NativeDestruct();
+}
+
+void UIndexedListContainer::BeginDestroy()
+{
+	if (EndFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+
+	if (BeginFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+		BeginFrameHandle.Reset();
+	}
+
+	ViewBuilder.Cancel();
+
+	Super::BeginDestroy();
+}
+
+void UIndexedListContainer::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (!IsVirtualized())
+	{
+		return;
+	}
+
+	const FVector2D CurrentViewportSize = EntriesCanvas->GetCachedGeometry().GetLocalSize();
+	if (!CurrentViewportSize.Equals(ViewportSize))
+	{
+		ViewportSize = CurrentViewportSize;
+		UpdateGridLayout();
+		bVirtualizationDirty = true;
+	}
+
+	if (bVirtualizationDirty)
+	{
+		RefreshVirtualization();
+	}
+}
+
+FReply UIndexedListContainer::NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+	if (!IsVirtualized() || GetMaxScrollOffset() <= 0.0)
+	{
+		return Super::NativeOnMouseWheel(InGeometry, InMouseEvent);
+	}
+
+	SetScrollOffset(ScrollOffset - InMouseEvent.GetWheelDelta() * WheelScrollAmount);
+	return FReply::Handled();
+}
+
+FReply UIndexedListContainer::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent)
+{
+	const FKey Key = InKeyEvent.GetKey();
+	TOptional<EIndexedListNavigation> Navigation;
+
+	if (Key == EKeys::Up || Key == EKeys::Gamepad_DPad_Up)
+	{
+		Navigation = EIndexedListNavigation::Up;
+	}
+	else if (Key == EKeys::Down || Key == EKeys::Gamepad_DPad_Down)
+	{
+		Navigation = EIndexedListNavigation::Down;
+	}
+	else if (IsGridLayout() && (Key == EKeys::Left || Key == EKeys::Gamepad_DPad_Left))
+	{
+		Navigation = EIndexedListNavigation::Previous;
+	}
+	else if (IsGridLayout() && (Key == EKeys::Right || Key == EKeys::Gamepad_DPad_Right))
+	{
+		Navigation = EIndexedListNavigation::Next;
+	}
+	else if (Key == EKeys::PageUp || Key == EKeys::Gamepad_LeftShoulder)
+	{
+		Navigation = EIndexedListNavigation::PageUp;
+	}
+	else if (Key == EKeys::PageDown || Key == EKeys::Gamepad_RightShoulder)
+	{
+		Navigation = EIndexedListNavigation::PageDown;
+	}
+	else if (Key == EKeys::Home)
+	{
+		Navigation = EIndexedListNavigation::Home;
+	}
+	else if (Key == EKeys::End)
+	{
+		Navigation = EIndexedListNavigation::End;
+	}
+
+	if (!bEnableKeyboardNavigation || !Navigation.IsSet() || GetNumRows() == 0)
+	{
+		return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
+	}
+
+	NavigateSelection(Navigation.GetValue());
+	return FReply::Handled();
+}
+
+FReply UIndexedListContainer::NativeOnKeyChar(const FGeometry& InGeometry, const FCharacterEvent& InCharEvent)
+{
+	const TCHAR Character = InCharEvent.GetCharacter();
+	if (!bEnableTypeahead || FChar::IsControl(Character))
+	{
+		return Super::NativeOnKeyChar(InGeometry, InCharEvent);
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastTypeaheadTime > TypeaheadResetDelay)
+	{
+		TypeaheadBuffer.Reset();
+	}
+
+	LastTypeaheadTime = Now;
+	TypeaheadBuffer.AppendChar(Character);
+
+	const int32 ItemIndex = FindItemByPrefix(TypeaheadBuffer);
+	if (ItemIndex == INDEX_NONE)
+	{
+		return Super::NativeOnKeyChar(InGeometry, InCharEvent);
+	}
+
+	SelectItemAtIndex(ItemIndex);
+	return FReply::Handled();
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+void UIndexedListContainer::RefreshVirtualizationForTesting(UCanvasPanel* InEntriesCanvas, const FVector2D& InViewportSize)
+{
+	EntriesCanvas = InEntriesCanvas;
+	if (!IsVirtualized())
+	{
+		return;
+	}
+
+	if (!InViewportSize.Equals(ViewportSize))
+	{
+		ViewportSize = InViewportSize;
+		UpdateGridLayout();
+	}
+
+	RefreshVirtualization();
+}
+#endif
+
+void UIndexedListContainer::RefreshVirtualization()
+{
+	bVirtualizationDirty = false;
+	UpdateGridLayout();
+	ScrollOffset = FMath::Clamp(ScrollOffset, 0.0, GetMaxScrollOffset());
+
+	int32 FirstRow = 0;
+	int32 EndRow = 0;
+	if (!GetMaterializedRange(FirstRow, EndRow))
+	{
+		ReleaseAllEntries();
+		return;
+	}
+
+	NotifyDataSourceVisibleRows(FirstRow, EndRow);
+
+	for (auto It = LiveEntries.CreateIterator(); It; ++It)
+	{
+		if (It.Key() < FirstRow || It.Key() >= EndRow)
+		{
+			ReleaseEntry(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	BuildEntries(FirstRow, EndRow);
+
+	if (IsGridLayout())
+	{
+		GridLayout.Compute(FirstRow, EndRow);
+	}
+
+	// Positions are applied after every new entry is measured, so one refresh settles all rows it materialized.
+	for (const auto& Pair : LiveEntries)
+	{
+		PositionEntry(Pair.Value, Pair.Key);
+	}
+}
+
+void UIndexedListContainer::BuildEntries(int32 InFirstRow, int32 InEndRow)
+{
+	int32 FirstVisibleRow = 0;
+	int32 EndVisibleRow = 0;
+	GetVisibleRange(FirstVisibleRow, EndVisibleRow);
+
+	TArray<int32, TInlineAllocator<64>> PendingRows;
+	for (int32 Row = InFirstRow; Row < InEndRow; ++Row)
+	{
+		const UUserWidget* Entry = LiveEntries.FindRef(Row);
+		if (!Entry || Entry->GetClass() != GetEntryClassForRow(Row))
+		{
+			PendingRows.Add(Row);
+		}
+	}
+
+	// Visible rows first from the top, then the overscan outwards from the viewport.
+	Algo::StableSortBy(PendingRows, [FirstVisibleRow, EndVisibleRow](int32 Row)
+	{
+		return Row < FirstVisibleRow ? FirstVisibleRow - Row : FMath::Max(Row - EndVisibleRow + 1, 0);
+	});
+
+	const double StartTime = FPlatformTime::Seconds();
+	if (bVisibleEntriesMaterialized && PendingRows.Num() > 0 && PendingRows[0] >= FirstVisibleRow && PendingRows[0] < EndVisibleRow)
+	{
+		bVisibleEntriesMaterialized = false;
+		MaterializationStartTime = StartTime;
+	}
+
+	const double BudgetSeconds = GetEntryBuildBudgetMs() / 1000.0;
+	bool bOutOfBudget = false;
+	bool bVisibleRowDeferred = false;
+
+	for (const int32 Row : PendingRows)
+	{
+		bOutOfBudget = bOutOfBudget || (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds);
+		if (bOutOfBudget)
+		{
+			// Rows that already show something keep it until a later frame gets to them.
+			if (PlaceholderEntryClass && !LiveEntries.Contains(Row))
+			{
+				if (UUserWidget* Placeholder = AcquireEntry(Row, PlaceholderEntryClass))
+				{
+					LiveEntries.Add(Row, Placeholder);
+				}
+			}
+
+			bVisibleRowDeferred |= Row >= FirstVisibleRow && Row < EndVisibleRow;
+			continue;
+		}
+
+		UUserWidget* PreviousEntry = nullptr;
+		if (LiveEntries.RemoveAndCopyValue(Row, PreviousEntry))
+		{
+			ReleaseEntry(PreviousEntry);
+		}
+
+		if (UUserWidget* Entry = AcquireEntry(Row, GetEntryClassForRow(Row)))
+		{
+			LiveEntries.Add(Row, Entry);
+		}
+	}
+
+	if (bOutOfBudget)
+	{
+		bVirtualizationDirty = true;
+	}
+
+	if (!bVisibleEntriesMaterialized && !bVisibleRowDeferred)
+	{
+		bVisibleEntriesMaterialized = true;
+
+		const float Seconds = static_cast<float>(FPlatformTime::Seconds() - MaterializationStartTime);
+		OnIndexedListEntriesMaterializedNative.Broadcast(Seconds);
+		OnIndexedListEntriesMaterialized.Broadcast(Seconds);
+	}
+}
+
+void UIndexedListContainer::NotifyDataSourceVisibleRows(int32 InFirstRow, int32 InEndRow)
+{
+	if (!IsValid(DataSource))
+	{
+		return;
+	}
+
+	// Direction follows the rows, item indices of a view jump around while it scrolls steadily.
+	const int32 ScrollDirection = FMath::Sign(InFirstRow - LastDataSourceFirstRow);
+	LastDataSourceFirstRow = InFirstRow;
+
+	if (!ActiveView)
+	{
+		DataSource->NotifyVisibleRange(InFirstRow, InEndRow, ElementsCount, ScrollDirection);
+		return;
+	}
+
+	if (ScrollDirection != 0)
+	{
+		DataSourceScrollDirection = ScrollDirection;
+	}
+
+	// Pages are addressed by item index, so the items of the visible rows are pinned together.
+	const TArray<int32>& RowToItem = ActiveView->RowToItem;
+	const int32 NumRows = RowToItem.Num();
+	const int32 NumPrefetchRows = DataSource->GetPrefetchPages() * DataSource->GetPageSize();
+
+	TArray<int32> PrefetchItems;
+	if (DataSourceScrollDirection > 0)
+	{
+		const int32 PrefetchEnd = FMath::Min(InEndRow + NumPrefetchRows, NumRows);
+		PrefetchItems.Append(RowToItem.GetData() + InEndRow, FMath::Max(PrefetchEnd - InEndRow, 0));
+	}
+	else
+	{
+		for (int32 Row = InFirstRow - 1; Row >= FMath::Max(InFirstRow - NumPrefetchRows, 0); --Row)
+		{
+			PrefetchItems.Add(RowToItem[Row]);
+		}
+	}
+
+	DataSource->NotifyVisibleItems(MakeArrayView(RowToItem.GetData() + InFirstRow, InEndRow - InFirstRow), PrefetchItems, ElementsCount);
+}
+
+void UIndexedListContainer::RequestViewBuild()
+{
+	ViewBuilder.Request(ElementsCount, ViewDesc.GetValue());
+
+	if (!BeginFrameHandle.IsValid())
+	{
+		BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddUObject(this, &UIndexedListContainer::SwapInCompletedView);
+	}
+}
+
+void UIndexedListContainer::SwapInCompletedView()
+{
+	// Checked before consuming, a build that finishes in between is picked up next frame.
+	const bool bStillBuilding = ViewBuilder.IsBuilding();
+
+	const auto CompletedView = ViewBuilder.ConsumeCompleted();
+	if (CompletedView && CompletedView->NumItems() == ElementsCount)
+	{
+		ApplyView(CompletedView);
+	}
+
+	if (!bStillBuilding)
+	{
+		FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+		BeginFrameHandle.Reset();
+	}
+}
+
+void UIndexedListContainer::ApplyView(TSharedPtr<const FIndexedListViewPermutation, ESPMode::ThreadSafe> InView)
+{
+	ActiveView = MoveTemp(InView);
+	ResetRowOffsets();
+	RebindLiveEntries();
+
+	if (!IsVirtualized())
+	{
+		OnElementsCountChanged(ElementsCount);
+	}
+
+	OnIndexedListViewChanged.Broadcast();
+}
+
+void UIndexedListContainer::RemapView(TFunctionRef<int32(int32)> RemapIndex)
+{
+	const TSharedRef<FIndexedListViewPermutation, ESPMode::ThreadSafe> View = MakeShared<FIndexedListViewPermutation, ESPMode::ThreadSafe>();
+	View->RowToItem.Reserve(ElementsCount);
+	View->ItemToRow.Init(INDEX_NONE, ElementsCount);
+
+	TBitArray<> KnownItems(false, ElementsCount);
+	for (int32 OldIndex = 0; OldIndex < ActiveView->NumItems(); ++OldIndex)
+	{
+		const int32 NewIndex = RemapIndex(OldIndex);
+		if (NewIndex != INDEX_NONE)
+		{
+			KnownItems[NewIndex] = true;
+		}
+	}
+
+	for (const int32 OldIndex : ActiveView->RowToItem)
+	{
+		const int32 NewIndex = RemapIndex(OldIndex);
+		if (NewIndex != INDEX_NONE)
+		{
+			View->ItemToRow[NewIndex] = View->RowToItem.Add(NewIndex);
+		}
+	}
+
+	// New items are shown at the end until the rebuilt view filters and sorts them.
+	for (int32 Index = 0; Index < ElementsCount; ++Index)
+	{
+		if (!KnownItems[Index])
+		{
+			View->ItemToRow[Index] = View->RowToItem.Add(Index);
+		}
+	}
+
+	ActiveView = View;
+}
+
+void UIndexedListContainer::RebindLiveEntries()
+{
+	const int32 NumRows = GetNumRows();
+	for (auto It = LiveEntries.CreateIterator(); It; ++It)
+	{
+		if (It.Key() >= NumRows)
+		{
+			ReleaseEntry(It.Value());
+			It.RemoveCurrent();
+			continue;
+		}
+
+		BindEntry(It.Value(), It.Key());
+		MeasureEntry(It.Value(), It.Key());
+	}
+
+	bVirtualizationDirty = true;
+}
+
+void UIndexedListContainer::ApplySelection(FIndexedListSelection&& InSelection, bool bInAppend)
+{
+	bool bSelectionChanged = false;
+	if (bInAppend)
+	{
+		for (const FIndexedListSelection::FRange& Range : InSelection.GetRanges())
+		{
+			bSelectionChanged |= Selection.Add(Range.Start, Range.End);
+		}
+	}
+	else if (Selection != InSelection)
+	{
+		Selection = MoveTemp(InSelection);
+		bSelectionChanged = true;
+	}
+
+	if (bSelectionChanged)
+	{
+		RefreshLiveEntrySelection();
+		NotifySelectionChanged();
+	}
+}
+
+TSubclassOf<UUserWidget> UIndexedListContainer::GetEntryClassForRow(int32 InRow) const
+{
+	if (PlaceholderEntryClass && IsValid(DataSource) && !DataSource->IsRowLoaded(GetItemIndexForRow(InRow)))
+	{
+		return PlaceholderEntryClass;
+	}
+
+	return EntryWidgetClass;
+}
+
+void UIndexedListContainer::InvalidateDataSourceRange(int32 InFirstIndex, int32 InEndIndex)
+{
+	if (!IsValid(DataSource))
+	{
+		return;
+	}
+
+	// Pages hold rows by index, so the ones the edit shifted are fetched again and their entries rebound.
+	DataSource->InvalidateRange(InFirstIndex, InEndIndex);
+	UpdateRange(InFirstIndex, FMath::Min(InEndIndex, ElementsCount) - InFirstIndex);
+}
+
+void UIndexedListContainer::HandlePageLoaded(int32 InFirstIndex, int32 InCount)
+{
+	UpdateRange(InFirstIndex, InCount);
+}
+
+void UIndexedListContainer::ConsumeTypeaheadIndex()
+{
+	if (PendingTypeaheadIndex.IsValid() && PendingTypeaheadIndex.IsCompleted())
+	{
+		TypeaheadIndex = PendingTypeaheadIndex.GetResult();
+		PendingTypeaheadIndex = {};
+	}
+}
+
+int32 UIndexedListContainer::GetNavigationTargetRow(EIndexedListNavigation InNavigation) const
+{
+	const int32 NumRows = GetNumRows();
+	if (NumRows == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 CurrentRow = GetRowForItemIndex(SelectedIndex);
+	if (CurrentRow == INDEX_NONE)
+	{
+		return InNavigation == EIndexedListNavigation::End ? NumRows - 1 : 0;
+	}
+
+	// Pages are measured in content space, so they work the same for uniform, variable and tiled rows.
+	const int32 Column = CurrentRow % GetNumColumns();
+	const double PageExtent = FMath::Max<double>(ViewportSize.Y, GetRowHeight(CurrentRow));
+
+	int32 TargetRow = CurrentRow;
+	switch (InNavigation)
+	{
+	case EIndexedListNavigation::Previous:
+		TargetRow = CurrentRow - 1;
+		break;
+	case EIndexedListNavigation::Next:
+		TargetRow = CurrentRow + 1;
+		break;
+	case EIndexedListNavigation::Up:
+		TargetRow = CurrentRow - GetNumColumns();
+		break;
+	case EIndexedListNavigation::Down:
+		TargetRow = CurrentRow + GetNumColumns();
+		break;
+	case EIndexedListNavigation::PageUp:
+		TargetRow = FindRowAtOffset(GetRowOffset(CurrentRow) - PageExtent) + (IsGridLayout() ? Column : 0);
+		break;
+	case EIndexedListNavigation::PageDown:
+		TargetRow = FindRowAtOffset(GetRowOffset(CurrentRow) + PageExtent) + (IsGridLayout() ? Column : 0);
+		break;
+	case EIndexedListNavigation::Home:
+		TargetRow = 0;
+		break;
+	case EIndexedListNavigation::End:
+		TargetRow = NumRows - 1;
+		break;
+	}
+
+	return FMath::Clamp(TargetRow, 0, NumRows - 1);
+}
+
+bool UIndexedListContainer::IsGridLayout() const noexcept
+{
+	return Layout == EIndexedListLayout::Grid;
+}
+
+bool UIndexedListContainer::UsesRowOffsets() const noexcept
+{
+	return bVariableEntryHeights && !IsGridLayout();
+}
+
+void UIndexedListContainer::UpdateGridLayout()
+{
+	if (!IsGridLayout())
+	{
+		return;
+	}
+
+	// Keep the first visible tile on screen when the column count changes.
+	const int32 AnchorRow = GridLayout.FindRowAtOffset(ScrollOffset, GetNumRows());
+	if (GridLayout.Configure(ViewportSize.X, TileSize, TileSpacing) && AnchorRow != INDEX_NONE)
+	{
+		ScrollOffset = GridLayout.GetLineTop(AnchorRow);
+	}
+}
+
+bool UIndexedListContainer::GetVisibleRange(int32& OutFirstRow, int32& OutEndRow) const
+{
+	if (GetNumRows() == 0 || ViewportSize.Y <= 0.0)
+	{
+		return false;
+	}
+
+	if (IsGridLayout())
+	{
+		return GridLayout.GetRowsInRange(ScrollOffset, ScrollOffset + ViewportSize.Y, GetNumRows(), 0, OutFirstRow, OutEndRow);
+	}
+
+	OutFirstRow = FindRowAtOffset(ScrollOffset);
+	OutEndRow = FindRowAtOffset(ScrollOffset + ViewportSize.Y) + 1;
+	return OutFirstRow < OutEndRow;
+}
+
+bool UIndexedListContainer::GetMaterializedRange(int32& OutFirstRow, int32& OutEndRow) const
+{
+	if (IsGridLayout() && ViewportSize.Y > 0.0)
+	{
+		return GridLayout.GetRowsInRange(ScrollOffset, ScrollOffset + ViewportSize.Y, GetNumRows(), OverscanCount, OutFirstRow, OutEndRow);
+	}
+
+	if (!GetVisibleRange(OutFirstRow, OutEndRow))
+	{
+		return false;
+	}
+
+	OutFirstRow = FMath::Max(OutFirstRow - OverscanCount, 0);
+	OutEndRow = FMath::Min(OutEndRow + OverscanCount, GetNumRows());
+	return OutFirstRow < OutEndRow;
+}
+
+double UIndexedListContainer::GetRowOffset(int32 InRow) const
+{
+	if (IsGridLayout())
+	{
+		return GridLayout.GetLineTop(InRow);
+	}
+
+	if (UsesRowOffsets())
+	{
+		return RowOffsets.GetOffset(InRow);
+	}
+
+	return static_cast<double>(InRow) * EntryHeight;
+}
+
+float UIndexedListContainer::GetRowHeight(int32 InRow) const
+{
+	if (IsGridLayout())
+	{
+		return static_cast<float>(GridLayout.GetTileSize().Y);
+	}
+
+	if (UsesRowOffsets())
+	{
+		return RowOffsets.GetHeight(InRow);
+	}
+
+	return EntryHeight;
+}
+
+int32 UIndexedListContainer::FindRowAtOffset(double InOffset) const
+{
+	const int32 NumRows = GetNumRows();
+	if (NumRows == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	if (IsGridLayout())
+	{
+		return GridLayout.FindRowAtOffset(InOffset, NumRows);
+	}
+
+	if (UsesRowOffsets())
+	{
+		return RowOffsets.FindIndexAtOffset(InOffset);
+	}
+
+	const int32 Row = FMath::FloorToInt32(InOffset / EntryHeight);
+	return FMath::Clamp(Row, 0, NumRows - 1);
+}
+
+double UIndexedListContainer::GetMaxScrollOffset() const
+{
+	return FMath::Max(GetContentExtent() - ViewportSize.Y, 0.0);
+}
+
+UUserWidget* UIndexedListContainer::AcquireEntry(int32 InRow, TSubclassOf<UUserWidget> InEntryClass)
+{
+	UUserWidget* Entry = EntryPool.Acquire(this, EntriesCanvas, InEntryClass);
+	if (!Entry)
+	{
+		UE_LOG(LogIndexedListContainer, Error, TEXT("Failed to create entry of class [%s]"), *GetNameSafe(InEntryClass));
+		return nullptr;
+	}
+
+	BindEntry(Entry, InRow);
+	MeasureEntry(Entry, InRow);
+	return Entry;
+}
+
+void UIndexedListContainer::ReleaseEntry(UUserWidget* Entry)
+{
+	if (!IsValid(Entry))
+	{
+		return;
+	}
+
+	if (Entry->Implements<UIndexedListEntryInterface>())
+	{
+		IIndexedListEntryInterface::Execute_OnEntryReleased(Entry);
+	}
+
+	EntryPool.Release(Entry);
+}
+
+void UIndexedListContainer::ReleaseAllEntries()
+{
+	for (const auto& Pair : LiveEntries)
+	{
+		ReleaseEntry(Pair.Value);
+	}
+
+	LiveEntries.Reset();
+}
+
+void UIndexedListContainer::BindEntry(UUserWidget* Entry, int32 InRow)
+{
+	if (!IsValid(Entry) || !Entry->Implements<UIndexedListEntryInterface>())
+	{
+		return;
+	}
+
+	const int32 ItemIndex = GetItemIndexForRow(InRow);
+	IIndexedListEntryInterface::Execute_BindToIndex(Entry, this, ItemIndex);
+	IIndexedListEntryInterface::Execute_SetEntrySelected(Entry, Selection.Contains(ItemIndex));
+}
+
+void UIndexedListContainer::MeasureEntry(UUserWidget* Entry, int32 InRow)
+{
+	// Placeholders don't know the size of the row they stand in for.
+	if (!UsesRowOffsets() || !IsValid(Entry) || Entry->GetClass() != EntryWidgetClass)
+	{
+		return;
+	}
+
+	Entry->ForceLayoutPrepass();
+	RefineRowHeight(InRow, Entry->GetDesiredSize().Y);
+}
+
+void UIndexedListContainer::RefineRowHeight(int32 InRow, float InHeight)
+{
+	const double RowTop = RowOffsets.GetOffset(InRow);
+	const float Delta = RowOffsets.SetHeight(InRow, InHeight);
+	if (Delta == 0.f)
+	{
+		return;
+	}
+
+	// Keep the rows on screen still when a row above them changes height.
+	if (RowTop < ScrollOffset)
+	{
+		ScrollOffset += Delta;
+	}
+
+	bVirtualizationDirty = true;
+}
+
+void UIndexedListContainer::ResetRowOffsets()
+{
+	if (!UsesRowOffsets())
+	{
+		RowOffsets.Reset(0, EntryHeight);
+		return;
+	}
+
+	const int32 NumRows = GetNumRows();
+	TArray<float> Heights;
+	Heights.SetNumUninitialized(NumRows);
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		Heights[Row] = EstimateItemHeight(GetItemIndexForRow(Row));
+	}
+
+	RowOffsets.Reset(MoveTemp(Heights));
+}
+
+void UIndexedListContainer::PositionEntry(UUserWidget* Entry, int32 InRow) const
+{
+	const auto EntrySlot = Cast<UCanvasPanelSlot>(Entry->Slot);
+	if (EntrySlot && IsGridLayout())
+	{
+		const FVector2D Position = GridLayout.GetPosition(InRow);
+		EntrySlot->SetPosition(FVector2D(Position.X, Position.Y - ScrollOffset));
+		EntrySlot->SetSize(GridLayout.GetTileSize());
+	}
+	else if (EntrySlot)
+	{
+		const double LocalTop = GetRowOffset(InRow) - ScrollOffset;
+		EntrySlot->SetPosition(FVector2D(0.0, LocalTop));
+		EntrySlot->SetSize(FVector2D(ViewportSize.X, GetRowHeight(InRow)));
+	}
+}
+
+void UIndexedListContainer::UpdateEntrySelection(int32 InIndex, bool bInSelected) const
+{
+	UUserWidget* Entry = GetEntryWidgetForIndex(InIndex);
+	if (IsValid(Entry) && Entry->Implements<UIndexedListEntryInterface>())
+	{
+		IIndexedListEntryInterface::Execute_SetEntrySelected(Entry, bInSelected);
+	}
+}
+
+void UIndexedListContainer::RefreshLiveEntrySelection() const
+{
+	for (const auto& Pair : LiveEntries)
+	{
+		const int32 ItemIndex = GetItemIndexForRow(Pair.Key);
+		UpdateEntrySelection(ItemIndex, Selection.Contains(ItemIndex));
+	}
+}
+
+void UIndexedListContainer::NotifySelectionChanged()
+{
+	if (SelectionEventCoalescing == EIndexedListEventCoalescing::Immediate)
+	{
+		OnIndexedListSelectionChangedNative.Broadcast();
+		OnIndexedListSelectionChanged.Broadcast();
+		return;
+	}
+
+	if (bPendingSelectionChanged)
+	{
+		++SuppressedSelectionBroadcasts;
+	}
+
+	bPendingSelectionChanged = true;
+	ScheduleSelectionFlush();
+}
+
+void UIndexedListContainer::NotifyItemSelected(int32 InIndex)
+{
+	switch (SelectionEventCoalescing)
+	{
+	case EIndexedListEventCoalescing::Immediate:
+		OnIndexedListItemSelectedNative.Broadcast(InIndex);
+		OnIndexedListItemSelected.Broadcast(InIndex);
+		return;
+	case EIndexedListEventCoalescing::LastIndex:
+		if (PendingSelectedIndices.Num() > 0)
+		{
+			++SuppressedSelectionBroadcasts;
+		}
+		PendingSelectedIndices.Reset();
+		PendingSelectedIndices.Add(InIndex);
+		break;
+	case EIndexedListEventCoalescing::UniqueIndices:
+		if (PendingSelectedIndices.Contains(InIndex))
+		{
+			++SuppressedSelectionBroadcasts;
+			break;
+		}
+		PendingSelectedIndices.Add(InIndex);
+		break;
+	}
+
+	ScheduleSelectionFlush();
+}
+
+void UIndexedListContainer::ScheduleSelectionFlush()
+{
+	if (!EndFrameHandle.IsValid())
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UIndexedListContainer::FlushSelectionEvents);
+	}
+}
+
+bool UIndexedListContainer::IsValidItemIndex(int32 InIndex) const
+{
+	if (InIndex < 0)
+	{
+		return false;
+	}
+
+	// Subclasses that build their own children may never report a count, their indices are not bounded.
+	return (!IsVirtualized() && !bElementsCountSet) || InIndex < ElementsCount;
+}
+
+bool UIndexedListContainer::CanMultiSelect() const
+{
+	return SelectionMode == EIndexedListSelectionMode::Multi;
+}
+
+void UIndexedListContainer::RemapIndices(TFunctionRef<int32(int32)> RemapIndex)
+{
+	if (SelectedIndex != INDEX_NONE)
+	{
+		SelectedIndex = RemapIndex(SelectedIndex);
+	}
+
+	if (ViewDesc.IsSet())
+	{
+		RequestViewBuild();
+	}
+
+	// Rows of a view don't follow item indices, every live row is bound again against the remapped view.
+	if (ActiveView)
+	{
+		RemapView(RemapIndex);
+		ResetRowOffsets();
+		RebindLiveEntries();
+		return;
+	}
+
+	TMap<int32, UUserWidget*> RemappedEntries;
+	RemappedEntries.Reserve(LiveEntries.Num());
+
+	for (const auto& Pair : LiveEntries)
+	{
+		const int32 NewIndex = RemapIndex(Pair.Key);
+		if (NewIndex == INDEX_NONE)
+		{
+			ReleaseEntry(Pair.Value);
+			continue;
+		}
+
+		if (NewIndex != Pair.Key && IsValid(Pair.Value) && Pair.Value->Implements<UIndexedListEntryInterface>())
+		{
+			IIndexedListEntryInterface::Execute_OnEntryIndexShifted(Pair.Value, NewIndex);
+		}
+
+		RemappedEntries.Add(NewIndex, Pair.Value);
+	}
+
+	LiveEntries = MoveTemp(RemappedEntries);
+	bVirtualizationDirty = true;
 }
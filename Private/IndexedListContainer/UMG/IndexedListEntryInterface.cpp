@@ -0,0 +1,7 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListContainer/UMG/IndexedListEntryInterface.h"
+
+
+// Add default functionality here for any IIndexedListEntryInterface functions that are not pure virtual.
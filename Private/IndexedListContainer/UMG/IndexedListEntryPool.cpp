@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "IndexedListContainer/UMG/IndexedListEntryPool.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/PanelWidget.h"
+
+UUserWidget* FIndexedListEntryPool::Acquire(UUserWidget* OwningWidget, UPanelWidget* HostPanel, TSubclassOf<UUserWidget> EntryClass)
+{
+	if (FIndexedListEntryBucket* Bucket = FreeEntries.Find(EntryClass))
+	{
+		while (Bucket->Entries.Num() > 0)
+		{
+			UUserWidget* Entry = Bucket->Entries.Pop(EAllowShrinking::No);
+			if (IsValid(Entry) && Entry->GetParent() == HostPanel)
+			{
+				++HitCount;
+				Entry->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+				return Entry;
+			}
+		}
+	}
+
+	++MissCount;
+	UUserWidget* Entry = CreateEntry(OwningWidget, HostPanel, EntryClass);
+	if (Entry)
+	{
+		Entry->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+	}
+
+	return Entry;
+}
+
+void FIndexedListEntryPool::Release(UUserWidget* Entry)
+{
+	if (!IsValid(Entry))
+	{
+		return;
+	}
+
+	Entry->SetVisibility(ESlateVisibility::Collapsed);
+	FreeEntries.FindOrAdd(Entry->GetClass()).Entries.Add(Entry);
+}
+
+void FIndexedListEntryPool::WarmUp(UUserWidget* OwningWidget, UPanelWidget* HostPanel, TSubclassOf<UUserWidget> EntryClass, int32 InCount)
+{
+	if (!EntryClass || !IsValid(HostPanel))
+	{
+		return;
+	}
+
+	FIndexedListEntryBucket& Bucket = FreeEntries.FindOrAdd(EntryClass);
+	Bucket.Entries.Reserve(InCount);
+
+	while (Bucket.Entries.Num() < InCount)
+	{
+		UUserWidget* Entry = CreateEntry(OwningWidget, HostPanel, EntryClass);
+		if (!Entry)
+		{
+			return;
+		}
+
+		Entry->SetVisibility(ESlateVisibility::Collapsed);
+		Bucket.Entries.Add(Entry);
+	}
+}
+
+int32 FIndexedListEntryPool::GetNumFree(TSubclassOf<UUserWidget> EntryClass) const
+{
+	const FIndexedListEntryBucket* Bucket = FreeEntries.Find(EntryClass);
+	return Bucket ? Bucket->Entries.Num() : 0;
+}
+
+void FIndexedListEntryPool::ResetStats()
+{
+	HitCount = 0;
+	MissCount = 0;
+}
+
+void FIndexedListEntryPool::Empty()
+{
+	for (const auto& Pair : FreeEntries)
+	{
+		for (UUserWidget* Entry : Pair.Value.Entries)
+		{
+			if (IsValid(Entry))
+			{
+				Entry->RemoveFromParent();
+			}
+		}
+	}
+
+	FreeEntries.Empty();
+}
+
+UUserWidget* FIndexedListEntryPool::CreateEntry(UUserWidget* OwningWidget, UPanelWidget* HostPanel, TSubclassOf<UUserWidget> EntryClass)
+{
+	if (!EntryClass || !IsValid(HostPanel))
+	{
+		return nullptr;
+	}
+
+	UUserWidget* Entry = CreateWidget<UUserWidget>(OwningWidget, EntryClass);
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	if (const auto EntrySlot = Cast<UCanvasPanelSlot>(HostPanel->AddChild(Entry)))
+	{
+		EntrySlot->SetAutoSize(false);
+		EntrySlot->SetAnchors(FAnchors(0.f, 0.f));
+		EntrySlot->SetAlignment(FVector2D::ZeroVector);
+	}
+
+	return Entry;
+}
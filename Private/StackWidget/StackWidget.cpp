@@ -5,10 +5,98 @@
 #include "Blueprint/WidgetTree.h"
 #include "Components/Overlay.h"
 #include "Components/OverlaySlot.h"
-#include "Kismet/KismetMathLibrary.h"
 
 #define LOCTEXT_NAMESPACE "CommonBasicWidgets"
 
+namespace StackWidget
+{
+    /**
+     * Transition policies. MakeParams runs once per transition and resolves everything that depends on the direction,
+     * InDirection is 1 for a push and -1 for a pop. The Apply functions run every frame and only interpolate.
+     */
+    struct FFadePolicy
+    {
+        static FStackTransitionParams MakeParams(const FStackAnimationSettings& InSettings, float InWidth, float InDirection)
+        {
+            return FStackTransitionParams();
+        }
+
+        static void ApplyIncoming(UWidget* Widget, const FStackTransitionParams& Params, float Alpha)
+        {
+            Widget->SetRenderOpacity(Alpha);
+        }
+
+        static void ApplyOutgoing(UWidget* Widget, const FStackTransitionParams& Params, float Alpha)
+        {
+            Widget->SetRenderOpacity(1.f - Alpha);
+        }
+    };
+
+    struct FSlidePolicy
+    {
+        static FStackTransitionParams MakeParams(const FStackAnimationSettings& InSettings, float InWidth, float InDirection)
+        {
+            FStackTransitionParams Params;
+            Params.IncomingTranslationFrom = FVector2D(InDirection * InWidth, 0.f);
+            Params.OutgoingTranslationTo = FVector2D(-InDirection * InWidth, 0.f);
+            return Params;
+        }
+
+        static void ApplyIncoming(UWidget* Widget, const FStackTransitionParams& Params, float Alpha)
+        {
+            Widget->SetRenderTranslation(Params.IncomingTranslationFrom * (1.f - Alpha));
+        }
+
+        static void ApplyOutgoing(UWidget* Widget, const FStackTransitionParams& Params, float Alpha)
+        {
+            Widget->SetRenderTranslation(Params.OutgoingTranslationTo * Alpha);
+        }
+    };
+
+    struct FScalePolicy
+    {
+        static FStackTransitionParams MakeParams(const FStackAnimationSettings& InSettings, float InWidth, float InDirection)
+        {
+            const float ScaleOffset = 1.f - InSettings.ScaleFrom;
+
+            FStackTransitionParams Params;
+            Params.IncomingScaleFrom = 1.f - InDirection * ScaleOffset;
+            Params.OutgoingScaleTo = 1.f + InDirection * ScaleOffset;
+            return Params;
+        }
+
+        static void ApplyIncoming(UWidget* Widget, const FStackTransitionParams& Params, float Alpha)
+        {
+            Widget->SetRenderScale(FVector2D(FMath::Lerp(Params.IncomingScaleFrom, 1.f, Alpha)));
+            Widget->SetRenderOpacity(Alpha);
+        }
+
+        static void ApplyOutgoing(UWidget* Widget, const FStackTransitionParams& Params, float Alpha)
+        {
+            Widget->SetRenderScale(FVector2D(FMath::Lerp(1.f, Params.OutgoingScaleTo, Alpha)));
+            Widget->SetRenderOpacity(1.f - Alpha);
+        }
+    };
+
+    /** Moves like a slide, only the widget on top travels the full width. */
+    struct FPushOverPolicy : FSlidePolicy
+    {
+        static FStackTransitionParams MakeParams(const FStackAnimationSettings& InSettings, float InWidth, float InDirection)
+        {
+            // On a push the incoming widget is on top, on a pop the outgoing one.
+            const float TopDistance = InWidth;
+            const float BeneathDistance = InWidth * InSettings.PushOverParallax;
+
+            FStackTransitionParams Params;
+            Params.IncomingTranslationFrom = FVector2D(InDirection > 0.f ? TopDistance : -BeneathDistance, 0.f);
+            Params.OutgoingTranslationTo = FVector2D(InDirection > 0.f ? -BeneathDistance : TopDistance, 0.f);
+            return Params;
+        }
+    };
+
+    static_assert(static_cast<int32>(EStackTransitionStyle::Num) == 4, "Every transition style needs a policy in StartTransitionAnimation");
+}
+
 UStackWidget::UStackWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , CurrentActiveWidget(nullptr)
@@ -98,7 +186,10 @@ int32 UStackWidget::GetStackSize() const
 
 void UStackWidget::ClearStack()
 {
-    AnimState.bIsAnimating = false;
+    if (IsAnimationTicking())
+    {
+        InterruptAnimation();
+    }
     
     for (UWidget* Widget : WidgetStack)
     {
@@ -119,46 +210,97 @@ void UStackWidget::UpdateWidgetVisibility()
         if (IsValid(Widget))
         {
             Widget->SetVisibility(Widget == CurrentActiveWidget ? ESlateVisibility::SelfHitTestInvisible : ESlateVisibility::Collapsed);
-            Widget->SetRenderOpacity(1.0f);
+            ResetWidgetTransition(Widget);
         }
     }
 }
 
 void UStackWidget::StartTransitionAnimation(EStackTransition TransitionType, UWidget* Incoming, UWidget* Outgoing)
 {
-    AnimState.ElapsedTime = 0.0f;
     AnimState.TransitionType = TransitionType;
-    AnimState.IncomingWidget = Incoming;
-    AnimState.OutgoingWidget = Outgoing;
+    AnimState.IncomingWidget = IsValid(Incoming) ? Incoming : nullptr;
+    AnimState.OutgoingWidget = IsValid(Outgoing) ? Outgoing : nullptr;
     AnimState.bIsAnimating = true;
 
-    if (IsValid(Incoming))
+    if (AnimState.IncomingWidget)
     {
-        Incoming->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+        AnimState.IncomingWidget->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
     }
-    if (TransitionType == EStackTransition::Push)
+
+    switch (AnimationSettings.TransitionStyle)
     {
-        Incoming->SetRenderOpacity(0.f);
+    case EStackTransitionStyle::Slide:
+        StartPolicyTransition<StackWidget::FSlidePolicy>();
+        break;
+    case EStackTransitionStyle::Scale:
+        StartPolicyTransition<StackWidget::FScalePolicy>();
+        break;
+    case EStackTransitionStyle::PushOver:
+        StartPolicyTransition<StackWidget::FPushOverPolicy>();
+        break;
+    default:
+        StartPolicyTransition<StackWidget::FFadePolicy>();
+        break;
     }
-
-    SetAnimationTicking(true);
 }
 
-void UStackWidget::SetAnimationTicking(bool bTicking)
+template <typename TPolicy>
+void UStackWidget::StartPolicyTransition()
 {
-    if (bTicking)
+    // The stack size of the last paint, reading it doesn't ask for a new layout.
+    const float Width = GetCachedGeometry().GetLocalSize().X;
+    AnimState.Params = TPolicy::MakeParams(AnimationSettings, Width, AnimState.TransitionType == EStackTransition::Push ? 1.f : -1.f);
+
+    // Pushing onto an empty stack has no outgoing widget and popping the last one no incoming widget.
+    if (AnimState.IncomingWidget && AnimState.OutgoingWidget)
+    {
+        AnimateTransition<TPolicy, true, true>();
+    }
+    else if (AnimState.IncomingWidget)
     {
-        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UStackWidget::Tick), 0.0f);
+        AnimateTransition<TPolicy, true, false>();
+    }
+    else if (AnimState.OutgoingWidget)
+    {
+        AnimateTransition<TPolicy, false, true>();
     }
     else
     {
-        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        AnimateTransition<TPolicy, false, false>();
     }
 }
 
+template <typename TPolicy, bool bHasIncoming, bool bHasOutgoing>
+void UStackWidget::AnimateTransition()
+{
+    // Start from the first frame, otherwise the incoming widget shows untransformed until the scheduler ticks.
+    TickAnimation<TPolicy, bHasIncoming, bHasOutgoing>(0.f);
+
+    FWidgetTransitionSettings TransitionSettings;
+    TransitionSettings.Duration = AnimationSettings.Duration;
+    TransitionSettings.EasingFunction = AnimationSettings.EasingFunction;
+    TransitionSettings.ExponentForEasing = AnimationSettings.ExponentForEasing;
+
+    // Always a new transition, the previous one was finished by InterruptAnimation and must not be retargeted.
+    TransitionHandle = FWidgetTransitionScheduler::Get().Animate(FWidgetTransitionHandle(), this, 0.f, 1.f, AnimationSettings.Duration, TransitionSettings,
+        [this](float EasedAlpha)
+        {
+            TickAnimation<TPolicy, bHasIncoming, bHasOutgoing>(EasedAlpha);
+        },
+        [this]()
+        {
+            TransitionHandle.Reset();
+            InterruptAnimation();
+        });
+}
+
 void UStackWidget::InterruptAnimation()
 {
     AnimState.bIsAnimating = false;
+    FWidgetTransitionScheduler::Get().Stop(TransitionHandle);
+
+    // A popped widget is handed back to the caller, it must not keep a transform from its way out.
+    ResetWidgetTransition(AnimState.OutgoingWidget);
             
     if (AnimState.TransitionType == EStackTransition::Pop && AnimState.OutgoingWidget)
     {
@@ -166,65 +308,39 @@ void UStackWidget::InterruptAnimation()
     }
             
     UpdateWidgetVisibility();
-            
-    SetAnimationTicking(false);
-}
-
-bool UStackWidget::Tick(float DeltaTime)
-{
-    if (!AnimState.bIsAnimating)
-    {
-        SetAnimationTicking(false);
-        return false;
-    }
-
-    TickAnimation(DeltaTime);
-
-    if (AnimState.ElapsedTime >= AnimationSettings.Duration)
-    {
-        InterruptAnimation();
-        return false;
-    }
-
-    return true;
 }
 
 bool UStackWidget::IsAnimationTicking() const noexcept
 {
-    if (auto Element = TickerHandle.Pin())
-    {
-        return Element->State != Element->RemovedState;
-    }
-
-    return false;
+    return AnimState.bIsAnimating && FWidgetTransitionScheduler::Get().IsRunning(TransitionHandle);
 }
 
-void UStackWidget::TickAnimation(float DeltaTime)
+template <typename TPolicy, bool bHasIncoming, bool bHasOutgoing>
+void UStackWidget::TickAnimation(float EasedAlpha)
 {
-    AnimState.ElapsedTime += DeltaTime;
-    const float Alpha = FMath::Clamp(AnimState.ElapsedTime / AnimationSettings.Duration, 0.0f, 1.0f);
-    const float EasedAlpha = UKismetMathLibrary::Ease(0.f, 1.f, Alpha, AnimationSettings.EasingFunction, AnimationSettings.ExponentForEasing);
-
-    if (AnimState.IncomingWidget)
+    if constexpr (bHasIncoming)
     {
-        ApplyAnimationToWidget(AnimState.IncomingWidget, EasedAlpha, true);
+        TPolicy::ApplyIncoming(AnimState.IncomingWidget, AnimState.Params, EasedAlpha);
     }
 
-    if (AnimState.OutgoingWidget)
+    if constexpr (bHasOutgoing)
     {
-        ApplyAnimationToWidget(AnimState.OutgoingWidget, EasedAlpha, false);
+        TPolicy::ApplyOutgoing(AnimState.OutgoingWidget, AnimState.Params, EasedAlpha);
     }
 }
 
-void UStackWidget::ApplyAnimationToWidget(UWidget* Widget, float Alpha, bool bFadeIn)
+void UStackWidget::ResetWidgetTransition(UWidget* Widget)
 {
     if (!IsValid(Widget))
     {
         return;
     }
 
-    const float TargetOpacity = bFadeIn ? Alpha : 1.0f - Alpha;
-    Widget->SetRenderOpacity(TargetOpacity);
+    Widget->SetRenderOpacity(1.0f);
+    if (!Widget->GetRenderTransform().IsIdentity())
+    {
+        Widget->SetRenderTransform(FWidgetTransform());
+    }
 }
 
 void UStackWidget::AddWidgetToOverlay(UWidget* Widget)
@@ -0,0 +1,142 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "StackWidget/StackWidget.h"
+
+#include "Blueprint/WidgetTree.h"
+#include "Components/Border.h"
+#include "Components/Overlay.h"
+#include "Containers/Ticker.h"
+#include "Debugging/SlateDebugging.h"
+#include "Engine/Engine.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UnrealType.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_SLATE_DEBUGGING
+
+namespace StackWidgetTest
+{
+	constexpr int32 FramesPerTransition = 10;
+	constexpr float FrameSeconds = 1.f / 60.f;
+
+	UWorld* FindWorld()
+	{
+		if (!GEngine)
+		{
+			return nullptr;
+		}
+
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if (UWorld* World = Context.World())
+			{
+				return World;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/** Stack built in code, RootOverlay is bound the way a widget blueprint would bind it. */
+	UStackWidget* CreateStack(UWorld* World, EStackTransitionStyle InStyle)
+	{
+		UStackWidget* Stack = CreateWidget<UStackWidget>(World);
+		if (!Stack->WidgetTree)
+		{
+			Stack->WidgetTree = NewObject<UWidgetTree>(Stack, TEXT("WidgetTree"), RF_Transient);
+		}
+
+		UOverlay* Overlay = Stack->WidgetTree->ConstructWidget<UOverlay>();
+		Stack->WidgetTree->RootWidget = Overlay;
+		if (FObjectProperty* RootOverlayProperty = FindFProperty<FObjectProperty>(UStackWidget::StaticClass(), TEXT("RootOverlay")))
+		{
+			RootOverlayProperty->SetObjectPropertyValue_InContainer(Stack, Overlay);
+		}
+
+		// Long enough that the measured frames never reach the end of the transition.
+		Stack->AnimationSettings.TransitionStyle = InStyle;
+		Stack->AnimationSettings.Duration = 1.f;
+		Stack->TakeWidget();
+		return Stack;
+	}
+
+	/** Advances the transitions of the shared scheduler, which runs from the core ticker. */
+	void TickFrames(int32 InNumFrames)
+	{
+		for (int32 Frame = 0; Frame < InNumFrames; ++Frame)
+		{
+			FTSTicker::GetCoreTicker().Tick(FrameSeconds);
+		}
+	}
+
+	/** Counts layout invalidations of the widgets pushed onto the stack. */
+	struct FLayoutInvalidationCounter
+	{
+		TSet<const SWidget*> Children;
+		int32 Count = 0;
+		FDelegateHandle Handle;
+
+		FLayoutInvalidationCounter()
+		{
+			Handle = FSlateDebugging::WidgetInvalidateEvent.AddLambda([this](const FSlateDebuggingInvalidateArgs& Args)
+			{
+				if (Children.Contains(Args.WidgetInvalidated) && EnumHasAnyFlags(Args.InvalidateWidgetReason, EInvalidateWidgetReason::Layout))
+				{
+					++Count;
+				}
+			});
+		}
+
+		~FLayoutInvalidationCounter()
+		{
+			FSlateDebugging::WidgetInvalidateEvent.Remove(Handle);
+		}
+	};
+}
+
+/**
+ * Pushes and pops a stack with every transition style and checks that the frames of its transitions
+ * only change render opacity and transforms, without invalidating the layout of the stacked widgets.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStackWidgetTransitionLayoutTest, "CommonBasicWidgets.StackWidget.TransitionsKeepLayout",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FStackWidgetTransitionLayoutTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = StackWidgetTest::FindWorld();
+	if (!TestNotNull(TEXT("World to create the stack in"), World))
+	{
+		return false;
+	}
+
+	for (int32 StyleIndex = 0; StyleIndex < static_cast<int32>(EStackTransitionStyle::Num); ++StyleIndex)
+	{
+		const EStackTransitionStyle Style = static_cast<EStackTransitionStyle>(StyleIndex);
+		const FString StyleName = StaticEnum<EStackTransitionStyle>()->GetNameStringByValue(StyleIndex);
+
+		UStackWidget* Stack = StackWidgetTest::CreateStack(World, Style);
+		StackWidgetTest::FLayoutInvalidationCounter Counter;
+
+		// Pushing and popping add and remove overlay slots and flip visibility, only the frames between are measured.
+		for (int32 Index = 0; Index < 2; ++Index)
+		{
+			UBorder* Child = Stack->WidgetTree->ConstructWidget<UBorder>();
+			Stack->PushWidget(Child);
+			Counter.Children.Add(Child->GetCachedWidget().Get());
+
+			Counter.Count = 0;
+			StackWidgetTest::TickFrames(StackWidgetTest::FramesPerTransition);
+			TestEqual(FString::Printf(TEXT("%s push %d layout invalidations"), *StyleName, Index), Counter.Count, 0);
+		}
+
+		Stack->PopWidget();
+		Counter.Count = 0;
+		StackWidgetTest::TickFrames(StackWidgetTest::FramesPerTransition);
+		TestEqual(FString::Printf(TEXT("%s pop layout invalidations"), *StyleName), Counter.Count, 0);
+
+		Stack->ClearStack();
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif
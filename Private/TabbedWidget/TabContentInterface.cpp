@@ -0,0 +1,7 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "TabbedWidget/TabContentInterface.h"
+
+
+// Add default functionality here for any ITabContentInterface functions that are not pure virtual.
@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "TabHeaderClickProxy.h"
+
+#include "TabbedWidget/TabbedWidget.h"
+
+void UTabHeaderClickProxy::Init(UTabbedWidget* InOwner, const FGuid& InTabId)
+{
+	Owner = InOwner;
+	TabId = InTabId;
+	ClickedEvent.BindDynamic(this, &UTabHeaderClickProxy::HandleClicked);
+}
+
+void UTabHeaderClickProxy::HandleClicked(TScriptInterface<ITabInterface> TabHeader)
+{
+	if (UTabbedWidget* TabbedWidget = Owner.Get())
+	{
+		TabbedWidget->OnTabClicked(TabId);
+	}
+}
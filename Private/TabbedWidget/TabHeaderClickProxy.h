@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TabbedWidget/TabInterface.h"
+#include "UObject/Object.h"
+#include "TabHeaderClickProxy.generated.h"
+
+class UTabbedWidget;
+
+/**
+ * Click binding of a single tab header. Dynamic delegates can't carry a payload,
+ * so every header is bound to its own proxy that knows which tab it belongs to.
+ */
+UCLASS(Transient)
+class UTabHeaderClickProxy : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void Init(UTabbedWidget* InOwner, const FGuid& InTabId);
+
+	/** Recycled strip headers are pointed at another tab instead of binding a new proxy. */
+	void SetTabId(const FGuid& InTabId) { TabId = InTabId; }
+
+	FOnTabHeaderClickedEvent& GetClickedEvent() noexcept { return ClickedEvent; }
+
+private:
+	TWeakObjectPtr<UTabbedWidget> Owner;
+	FGuid TabId;
+	FOnTabHeaderClickedEvent ClickedEvent;
+
+	UFUNCTION()
+	void HandleClicked(TScriptInterface<ITabInterface> TabHeader);
+};
@@ -0,0 +1,7 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "TabbedWidget/TabHeaderEntryInterface.h"
+
+
+// Add default functionality here for any ITabHeaderEntryInterface functions that are not pure virtual.
@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "TabbedWidget/TabSwitchHistory.h"
+
+void FTabSwitchHistory::Add(ETabSwitchPhase Phase, float Milliseconds)
+{
+	FWindow& Window = Windows[static_cast<int32>(Phase)];
+	if (Window.Samples.Num() < WindowSize)
+	{
+		Window.Samples.Add(Milliseconds);
+		return;
+	}
+
+	Window.Samples[Window.Next] = Milliseconds;
+	Window.Next = (Window.Next + 1) % WindowSize;
+}
+
+FTabSwitchPercentiles FTabSwitchHistory::GetPercentiles(ETabSwitchPhase Phase) const
+{
+	FTabSwitchPercentiles Percentiles;
+	const FWindow& Window = Windows[static_cast<int32>(Phase)];
+	if (Window.Samples.Num() == 0)
+	{
+		return Percentiles;
+	}
+
+	TArray<float, TInlineAllocator<WindowSize>> Sorted(Window.Samples);
+	Sorted.Sort();
+
+	// Nearest rank.
+	const auto Percentile = [&Sorted](float Fraction)
+	{
+		return Sorted[FMath::Clamp(FMath::CeilToInt32(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1)];
+	};
+
+	Percentiles.NumSamples = Sorted.Num();
+	Percentiles.P50Ms = Percentile(0.5f);
+	Percentiles.P90Ms = Percentile(0.9f);
+	Percentiles.P99Ms = Percentile(0.99f);
+	Percentiles.MaxMs = Sorted.Last();
+	return Percentiles;
+}
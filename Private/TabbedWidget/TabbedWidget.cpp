@@ -3,161 +3,1574 @@
 
 #include "TabbedWidget/TabbedWidget.h"
 
+#include "Blueprint/WidgetTree.h"
+#include "Components/ComboBoxString.h"
 #include "Components/PanelWidget.h"
+#include "Components/SizeBox.h"
+#include "Components/Spacer.h"
+#include "Components/TextBlock.h"
 #include "Components/WidgetSwitcher.h"
+#include "Components/WidgetSwitcherSlot.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Editor/WidgetCompilerLog.h"
+#include "HAL/IConsoleManager.h"
 #include "Misc/UObjectToken.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UObject/UObjectIterator.h"
+#include "TabbedWidget/TabHeaderEntryInterface.h"
 #include "TabbedWidget/TabInterface.h"
+#include "TabHeaderClickProxy.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogTabbedWidget, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("TabbedWidget"), STATGROUP_TabbedWidget, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Switch To Tab"), STAT_TabbedWidgetSwitchToTab, STATGROUP_TabbedWidget);
+DECLARE_CYCLE_STAT(TEXT("Prewarm"), STAT_TabbedWidgetPrewarm, STATGROUP_TabbedWidget);
+DECLARE_CYCLE_STAT(TEXT("Build Content"), STAT_TabbedWidgetBuildContent, STATGROUP_TabbedWidget);
+DECLARE_CYCLE_STAT(TEXT("Layout Prepass"), STAT_TabbedWidgetLayoutPrepass, STATGROUP_TabbedWidget);
+DECLARE_CYCLE_STAT(TEXT("OnTabChanged Listeners"), STAT_TabbedWidgetListeners, STATGROUP_TabbedWidget);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Switch Latency (ms)"), STAT_TabbedWidgetSwitchLatency, STATGROUP_TabbedWidget);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last First Paint (ms)"), STAT_TabbedWidgetFirstPaint, STATGROUP_TabbedWidget);
+
+static TAutoConsoleVariable<bool> CVarTabbedWidgetMeasurePrepass(
+	TEXT("TabbedWidget.MeasurePrepass"),
+	false,
+	TEXT("Runs the layout prepass of a newly shown tab during the switch to record its cost. Off leaves it to the next paint."));
+
+static FAutoConsoleCommand DumpTabSwitchStatsCommand(
+	TEXT("TabbedWidget.DumpSwitchStats"),
+	TEXT("Logs per tab percentiles of the latest switches of every tabbed widget, split into construction, prepass, first paint and listeners."),
+	FConsoleCommandDelegate::CreateStatic([]()
+	{
+		for (TObjectIterator<UTabbedWidget> It; It; ++It)
+		{
+			if (!It->IsTemplate() && It->GetTabCount() > 0)
+			{
+				It->DumpSwitchStats();
+			}
+		}
+	}));
+
+namespace TabbedWidget
+{
+	constexpr int32 SnapshotVersion = 1;
+
+	struct FSnapshotTab
+	{
+		FGuid TabId;
+		FText Label;
+		FString ContentClassPath;
+		bool bHasState = false;
+		FTabContentState State;
+
+		friend FArchive& operator<<(FArchive& Ar, FSnapshotTab& Tab)
+		{
+			Ar << Tab.TabId << Tab.Label << Tab.ContentClassPath << Tab.bHasState;
+			if (Tab.bHasState)
+			{
+				Ar << Tab.State.Values << Tab.State.Data;
+			}
+			return Ar;
+		}
+	};
+
+	/** Checks header and content pairs up front, so a batch is added or rejected as a whole. */
+	static bool ValidateTabWidgets(const TArray<UUserWidget*>& TabHeaderWidgets, const TArray<UUserWidget*>& TabContentWidgets)
+	{
+		if (TabHeaderWidgets.Num() != TabContentWidgets.Num())
+		{
+			UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add %d tab headers with %d tab contents"), TabHeaderWidgets.Num(), TabContentWidgets.Num());
+			return false;
+		}
+
+		for (int32 Index = 0; Index < TabHeaderWidgets.Num(); ++Index)
+		{
+			if (!TabHeaderWidgets[Index] || !TabContentWidgets[Index])
+			{
+				UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab %d with null widgets"), Index);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static double MillisecondsSince(double StartTime)
+	{
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	}
+}
+
 void UTabbedWidget::AddTab(UUserWidget* TabHeaderWidget, UUserWidget* TabContentWidget)
 {
-	if (!TabHeaderWidget || !TabContentWidget)
+	if (!TabHeaderWidget || !TabContentWidget)
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab with null widgets"));
+		return;
+	}
+
+	FTabEntry Entry;
+	Entry.Header = TabHeaderWidget;
+	Entry.Content = TabContentWidget;
+	AddTabEntry(MoveTemp(Entry));
+}
+
+void UTabbedWidget::AddTabWithContentClass(UUserWidget* TabHeaderWidget, TSubclassOf<UUserWidget> TabContentClass)
+{
+	if (!TabHeaderWidget || !TabContentClass)
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab with null header or content class"));
+		return;
+	}
+
+	FTabEntry Entry;
+	Entry.Header = TabHeaderWidget;
+	Entry.ContentClass = TabContentClass;
+	AddTabEntry(MoveTemp(Entry));
+}
+
+void UTabbedWidget::AddTabWithContentFactory(UUserWidget* TabHeaderWidget, FTabContentFactory TabContentFactory)
+{
+	if (!TabContentFactory.IsBound())
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab with unbound content factory"));
+		return;
+	}
+
+	AddTabWithNativeContentFactory(TabHeaderWidget, [TabContentFactory]()
+	{
+		return TabContentFactory.Execute();
+	});
+}
+
+void UTabbedWidget::AddTabWithNativeContentFactory(UUserWidget* TabHeaderWidget, TFunction<UUserWidget*()>&& TabContentFactory)
+{
+	if (!TabHeaderWidget || !TabContentFactory)
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab with null header or content factory"));
+		return;
+	}
+
+	FTabEntry Entry;
+	Entry.Header = TabHeaderWidget;
+	Entry.ContentFactory = MoveTemp(TabContentFactory);
+	AddTabEntry(MoveTemp(Entry));
+}
+
+void UTabbedWidget::AddTabWithSoftContentClass(UUserWidget* TabHeaderWidget, TSoftClassPtr<UUserWidget> TabContentClass)
+{
+	if (!TabHeaderWidget || TabContentClass.IsNull())
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab with null header or content class"));
+		return;
+	}
+
+	FTabEntry Entry;
+	Entry.Header = TabHeaderWidget;
+	Entry.SoftContentClass = TabContentClass;
+	AddTabEntry(MoveTemp(Entry));
+}
+
+void UTabbedWidget::AddLabeledTab(const FText& Label, UUserWidget* TabContentWidget)
+{
+	if (!TabContentWidget)
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab with null content widget"));
+		return;
+	}
+
+	FTabEntry Entry;
+	Entry.Label = Label;
+	Entry.Content = TabContentWidget;
+	AddTabEntry(MoveTemp(Entry));
+}
+
+void UTabbedWidget::AddLabeledTabWithContentClass(const FText& Label, TSubclassOf<UUserWidget> TabContentClass)
+{
+	if (!TabContentClass)
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab with null content class"));
+		return;
+	}
+
+	FTabEntry Entry;
+	Entry.Label = Label;
+	Entry.ContentClass = TabContentClass;
+	AddTabEntry(MoveTemp(Entry));
+}
+
+void UTabbedWidget::AddLabeledTabWithSoftContentClass(const FText& Label, TSoftClassPtr<UUserWidget> TabContentClass)
+{
+	if (TabContentClass.IsNull())
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab with null content class"));
+		return;
+	}
+
+	FTabEntry Entry;
+	Entry.Label = Label;
+	Entry.SoftContentClass = TabContentClass;
+	AddTabEntry(MoveTemp(Entry));
+}
+
+bool UTabbedWidget::IsTabContentLoading(int32 TabIndex) const
+{
+	return Tabs.IsValidIndex(TabIndex) && Tabs[TabIndex].LoadHandle.IsValid();
+}
+
+FText UTabbedWidget::GetTabLabel(int32 TabIndex) const
+{
+	return Tabs.IsValidIndex(TabIndex) ? Tabs[TabIndex].Label : FText::GetEmpty();
+}
+
+void UTabbedWidget::SetTabLabel(int32 TabIndex, const FText& Label)
+{
+	if (!Tabs.IsValidIndex(TabIndex))
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Invalid tab index: %d"), TabIndex);
+		return;
+	}
+
+	Tabs[TabIndex].Label = Label;
+	bOverflowDirty = true;
+
+	// Forces the header showing the tab to bind again and read the new label.
+	for (FTabHeaderStripSlot& StripSlot : HeaderStripSlots)
+	{
+		if (StripSlot.TabIndex == TabIndex)
+		{
+			StripSlot.TabIndex = INDEX_NONE;
+		}
+	}
+
+	if (UpdateDepth == 0)
+	{
+		RefreshHeaderStrip();
+	}
+}
+
+bool UTabbedWidget::UsesHeaderStrip() const
+{
+	return bVirtualizeHeaders && HeaderWidgetClass;
+}
+
+void UTabbedWidget::ScrollHeaderStrip(int32 Delta)
+{
+	HeaderStripFirst += Delta;
+	RefreshHeaderStrip();
+}
+
+int32 UTabbedWidget::GetFirstStripTabIndex() const
+{
+	return HeaderStripFirst;
+}
+
+int32 UTabbedWidget::GetNumStripHeaders() const
+{
+	return FMath::Min(HeaderStripCapacity, Tabs.Num() - HeaderStripFirst);
+}
+
+void UTabbedWidget::PrewarmTab(int32 TabIndex)
+{
+	if (!Tabs.IsValidIndex(TabIndex))
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Invalid tab index: %d"), TabIndex);
+		return;
+	}
+
+	if (EnsureTabContent(TabIndex))
+	{
+		Tabs[TabIndex].LastUsed = ++TabUseCounter;
+		EvictToBudget();
+	}
+}
+
+bool UTabbedWidget::IsTabContentBuilt(int32 TabIndex) const
+{
+	return Tabs.IsValidIndex(TabIndex) && Tabs[TabIndex].IsContentLive();
+}
+
+UUserWidget* UTabbedWidget::GetTabContent(int32 TabIndex) const
+{
+	return Tabs.IsValidIndex(TabIndex) ? Tabs[TabIndex].Content : nullptr;
+}
+
+void UTabbedWidget::EvictTabContent(int32 TabIndex)
+{
+	if (!Tabs.IsValidIndex(TabIndex) || TabIndex == ActiveTabIndex || Tabs[TabIndex].TabId == DisplayedTabId)
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot evict tab %d"), TabIndex);
+		return;
+	}
+
+	FTabEntry& Entry = Tabs[TabIndex];
+	if (!Entry.IsContentLive())
+	{
+		return;
+	}
+
+	if (Entry.Content->Implements<UTabContentInterface>())
+	{
+		Entry.SavedState = ITabContentInterface::Execute_SaveTabContentState(Entry.Content);
+		Entry.bHasSavedState = true;
+	}
+
+	UUserWidget* Content = Entry.Content;
+	Entry.Placeholder = WidgetTree->ConstructWidget<USpacer>();
+	SetSwitcherChild(TabIndex, Entry.Placeholder);
+
+	if (Entry.IsLazy())
+	{
+		// Built again from the class or factory, the old content is left to garbage collection.
+		Entry.Content = nullptr;
+		Entry.bContentSuspended = false;
+
+		// Resolved again on the next build, holding a streamed in class would keep it and its assets loaded.
+		if (!Entry.SoftContentClass.IsNull())
+		{
+			Entry.ContentClass = nullptr;
+		}
+	}
+	else
+	{
+		Entry.bContentDetached = true;
+	}
+
+	Content->ReleaseSlateResources(true);
+}
+
+void UTabbedWidget::AddTabs(const TArray<UUserWidget*>& TabHeaderWidgets, const TArray<UUserWidget*>& TabContentWidgets)
+{
+	if (!TabbedWidget::ValidateTabWidgets(TabHeaderWidgets, TabContentWidgets))
+	{
+		return;
+	}
+
+	BeginUpdate();
+
+	Tabs.Reserve(Tabs.Num() + TabHeaderWidgets.Num());
+	TabIndexById.Reserve(Tabs.Num() + TabHeaderWidgets.Num());
+	TabIndexByHeader.Reserve(Tabs.Num() + TabHeaderWidgets.Num());
+
+	for (int32 Index = 0; Index < TabHeaderWidgets.Num(); ++Index)
+	{
+		AddTab(TabHeaderWidgets[Index], TabContentWidgets[Index]);
+	}
+
+	EndUpdate();
+}
+
+void UTabbedWidget::SetTabs(const TArray<UUserWidget*>& TabHeaderWidgets, const TArray<UUserWidget*>& TabContentWidgets)
+{
+	// Invalid arrays leave the current tabs alone.
+	if (!TabbedWidget::ValidateTabWidgets(TabHeaderWidgets, TabContentWidgets))
+	{
+		return;
+	}
+
+	BeginUpdate();
+	ClearTabs();
+	AddTabs(TabHeaderWidgets, TabContentWidgets);
+	EndUpdate();
+}
+
+void UTabbedWidget::RemoveTab(int32 TabIndex)
+{
+	RemoveTabs(TabIndex, 1);
+}
+
+void UTabbedWidget::RemoveTabs(int32 FirstTabIndex, int32 Count)
+{
+	const int32 EndTabIndex = FirstTabIndex + Count;
+	if (Count <= 0 || !Tabs.IsValidIndex(FirstTabIndex) || EndTabIndex > Tabs.Num())
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Invalid tab range: %d, %d"), FirstTabIndex, Count);
+		return;
+	}
+
+	BeginUpdate();
+
+	const bool bUsesHeaderStrip = UsesHeaderStrip();
+	if (FirstTabIndex == 0 && EndTabIndex == Tabs.Num() && (bUsesHeaderStrip || TabHeadersContainer->GetChildrenCount() == Tabs.Num()))
+	{
+		for (FTabEntry& Entry : Tabs)
+		{
+			UnregisterTabHeader(Entry);
+			CancelContentLoad(Entry);
+		}
+
+		// The strip keeps its recycled headers.
+		if (!bUsesHeaderStrip)
+		{
+			TabHeadersContainer->ClearChildren();
+		}
+		ContentSwitcher->ClearChildren();
+	}
+	else
+	{
+		// Back to front, so every removal only shifts the slots after the range.
+		for (int32 TabIndex = EndTabIndex - 1; TabIndex >= FirstTabIndex; --TabIndex)
+		{
+			UnregisterTabHeader(Tabs[TabIndex]);
+			CancelContentLoad(Tabs[TabIndex]);
+			if (Tabs[TabIndex].Header)
+			{
+				TabHeadersContainer->RemoveChild(Tabs[TabIndex].Header);
+			}
+			ContentSwitcher->RemoveChild(Tabs[TabIndex].GetSwitcherWidget());
+		}
+	}
+
+	Tabs.RemoveAt(FirstTabIndex, Count);
+	ReindexTabs(FirstTabIndex);
+	bOverflowDirty = true;
+
+	if (Tabs.Num() == 0)
+	{
+		ActiveTabIndex = -1;
+	}
+	else if (ActiveTabIndex >= EndTabIndex)
+	{
+		ActiveTabIndex -= Count;
+	}
+	else if (ActiveTabIndex >= FirstTabIndex)
+	{
+		ActiveTabIndex = FMath::Clamp(FirstTabIndex - 1, 0, Tabs.Num() - 1);
+	}
+
+	EndUpdate();
+}
+
+void UTabbedWidget::BeginUpdate()
+{
+	if (UpdateDepth++ == 0)
+	{
+		ActiveTabIndexBeforeUpdate = ActiveTabIndex;
+		ActiveTabIdBeforeUpdate = GetTabId(ActiveTabIndex);
+		CancelPrewarm();
+	}
+}
+
+void UTabbedWidget::EndUpdate()
+{
+	if (UpdateDepth <= 0)
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("EndUpdate without a matching BeginUpdate"));
+		return;
+	}
+
+	if (--UpdateDepth > 0)
+	{
+		return;
+	}
+
+	if (!Tabs.IsValidIndex(ActiveTabIndex))
+	{
+		ActiveTabIndex = -1;
+		if (IsValid(ContentSwitcher))
+		{
+			StopContentTransition();
+		}
+		RefreshHeaderStrip();
+		return;
+	}
+
+	// The same tab at the same index is no change, even if it was switched away from and back within the update.
+	const bool bChanged = ActiveTabIndex != ActiveTabIndexBeforeUpdate || Tabs[ActiveTabIndex].TabId != ActiveTabIdBeforeUpdate;
+	ActivateTab(ActiveTabIndex, bChanged);
+}
+
+void UTabbedWidget::SwitchToTab(int32 TabIndex)
+{
+	if (!Tabs.IsValidIndex(TabIndex))
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Invalid tab index: %d"), TabIndex);
+		return;
+	}
+
+	if (UpdateDepth > 0)
+	{
+		ActiveTabIndex = TabIndex;
+		return;
+	}
+
+	ActivateTab(TabIndex, true);
+}
+
+int32 UTabbedWidget::GetActiveTabIndex() const
+{
+	return ActiveTabIndex;
+}
+
+int32 UTabbedWidget::GetTabCount() const
+{
+	return Tabs.Num();
+}
+
+FGuid UTabbedWidget::GetTabId(int32 TabIndex) const
+{
+	return Tabs.IsValidIndex(TabIndex) ? Tabs[TabIndex].TabId : FGuid();
+}
+
+int32 UTabbedWidget::FindTabIndexById(const FGuid& TabId) const
+{
+	const int32* TabIndex = TabIndexById.Find(TabId);
+	return TabIndex ? *TabIndex : INDEX_NONE;
+}
+
+int32 UTabbedWidget::FindTabIndexByHeader(UUserWidget* TabHeaderWidget) const
+{
+	if (const int32* TabIndex = TabIndexByHeader.Find(TabHeaderWidget))
+	{
+		return *TabIndex;
+	}
+
+	for (const FTabHeaderStripSlot& StripSlot : HeaderStripSlots)
+	{
+		if (StripSlot.Header == TabHeaderWidget)
+		{
+			return StripSlot.TabIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+int32 UTabbedWidget::GetTabSuspendedWorkCount(int32 TabIndex) const
+{
+#if !UE_BUILD_SHIPPING
+	return Tabs.IsValidIndex(TabIndex) ? Tabs[TabIndex].SuspendedWorkCount : 0;
+#else
+	return 0;
+#endif
+}
+
+float UTabbedWidget::GetLastSwitchLatencyMs() const
+{
+	return LastSwitchLatencyMs;
+}
+
+FTabSwitchPercentiles UTabbedWidget::GetTabSwitchPercentiles(int32 TabIndex, ETabSwitchPhase Phase) const
+{
+	if (!Tabs.IsValidIndex(TabIndex) || Phase == ETabSwitchPhase::Num)
+	{
+		return FTabSwitchPercentiles();
+	}
+
+	return Tabs[TabIndex].SwitchHistory.GetPercentiles(Phase);
+}
+
+void UTabbedWidget::DumpSwitchStats() const
+{
+	UE_LOG(LogTabbedWidget, Display, TEXT("%s: %d tabs, phase samples p50 / p90 / p99 / max ms"), *GetPathName(), Tabs.Num());
+
+	for (int32 TabIndex = 0; TabIndex < Tabs.Num(); ++TabIndex)
+	{
+		FString Line = FString::Printf(TEXT("  %d [%s]"), TabIndex, Tabs[TabIndex].Label.IsEmpty() ? *GetNameSafe(Tabs[TabIndex].Header) : *Tabs[TabIndex].Label.ToString());
+
+		for (int32 Phase = 0; Phase < static_cast<int32>(ETabSwitchPhase::Num); ++Phase)
+		{
+			const FTabSwitchPercentiles Percentiles = Tabs[TabIndex].SwitchHistory.GetPercentiles(static_cast<ETabSwitchPhase>(Phase));
+			Line += FString::Printf(TEXT(", %s %d: %.2f / %.2f / %.2f / %.2f"), *StaticEnum<ETabSwitchPhase>()->GetNameStringByIndex(Phase),
+				Percentiles.NumSamples, Percentiles.P50Ms, Percentiles.P90Ms, Percentiles.P99Ms, Percentiles.MaxMs);
+		}
+
+		UE_LOG(LogTabbedWidget, Display, TEXT("%s"), *Line);
+	}
+}
+
+void UTabbedWidget::ClearTabs()
+{
+	if (Tabs.Num() > 0)
+	{
+		RemoveTabs(0, Tabs.Num());
+	}
+}
+
+void UTabbedWidget::SaveTabsSnapshot(TArray<uint8>& OutData) const
+{
+	TArray<TabbedWidget::FSnapshotTab> SnapshotTabs;
+	SnapshotTabs.Reserve(Tabs.Num());
+	int32 SnapshotActiveIndex = INDEX_NONE;
+
+	for (int32 TabIndex = 0; TabIndex < Tabs.Num(); ++TabIndex)
+	{
+		const FTabEntry& Entry = Tabs[TabIndex];
+		const UClass* ContentClass = Entry.ContentClass ? Entry.ContentClass.Get() : Entry.Content ? Entry.Content->GetClass() : nullptr;
+		if (!ContentClass && Entry.SoftContentClass.IsNull())
+		{
+			UE_LOG(LogTabbedWidget, Warning, TEXT("Tab %d has no content class and is left out of the snapshot"), TabIndex);
+			continue;
+		}
+
+		if (TabIndex == ActiveTabIndex)
+		{
+			SnapshotActiveIndex = SnapshotTabs.Num();
+		}
+
+		TabbedWidget::FSnapshotTab& SnapshotTab = SnapshotTabs.AddDefaulted_GetRef();
+		SnapshotTab.TabId = Entry.TabId;
+		SnapshotTab.Label = Entry.Label;
+		SnapshotTab.ContentClassPath = !Entry.SoftContentClass.IsNull() ? Entry.SoftContentClass.ToString() : ContentClass->GetPathName();
+
+		if (Entry.IsContentLive() && Entry.Content->Implements<UTabContentInterface>())
+		{
+			SnapshotTab.State = ITabContentInterface::Execute_SaveTabContentState(Entry.Content);
+			SnapshotTab.bHasState = true;
+		}
+		else if (Entry.bHasSavedState)
+		{
+			SnapshotTab.State = Entry.SavedState;
+			SnapshotTab.bHasState = true;
+		}
+	}
+
+	OutData.Reset();
+	FMemoryWriter Writer(OutData);
+
+	int32 Version = TabbedWidget::SnapshotVersion;
+	Writer << Version << SnapshotActiveIndex << SnapshotTabs;
+}
+
+bool UTabbedWidget::RestoreTabsSnapshot(const TArray<uint8>& Data)
+{
+	if (!IsValid(TabHeadersContainer) || !IsValid(ContentSwitcher))
+	{
+		UE_LOG(LogTabbedWidget, Error, TEXT("Container widgets not initialized"));
+		return false;
+	}
+
+	if (!HeaderWidgetClass)
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Restoring tabs needs a HeaderWidgetClass"));
+		return false;
+	}
+
+	// No string or array inside the blob can be larger than the blob itself.
+	FMemoryReader Reader(Data);
+	Reader.ArMaxSerializeSize = Data.Num();
+
+	int32 Version = 0;
+	int32 SnapshotActiveIndex = INDEX_NONE;
+	int32 NumSnapshotTabs = 0;
+	TArray<TabbedWidget::FSnapshotTab> SnapshotTabs;
+
+	Reader << Version;
+	if (Reader.IsError() || Version != TabbedWidget::SnapshotVersion)
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Unsupported tabs snapshot version %d"), Version);
+		return false;
+	}
+
+	// Same layout as the array written by SaveTabsSnapshot, with the count bounded by the tab ids the blob can hold.
+	Reader << SnapshotActiveIndex << NumSnapshotTabs;
+	if (Reader.IsError() || NumSnapshotTabs < 0 || NumSnapshotTabs > Data.Num() / static_cast<int32>(sizeof(FGuid)))
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Corrupted tabs snapshot"));
+		return false;
+	}
+
+	SnapshotTabs.SetNum(NumSnapshotTabs);
+	TSet<FGuid> SnapshotTabIds;
+	SnapshotTabIds.Reserve(NumSnapshotTabs);
+	for (TabbedWidget::FSnapshotTab& SnapshotTab : SnapshotTabs)
+	{
+		Reader << SnapshotTab;
+
+		bool bDuplicateId = false;
+		SnapshotTabIds.Add(SnapshotTab.TabId, &bDuplicateId);
+		if (Reader.IsError() || bDuplicateId)
+		{
+			UE_LOG(LogTabbedWidget, Warning, TEXT("Corrupted tabs snapshot"));
+			return false;
+		}
+	}
+
+	if (!Reader.AtEnd())
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Corrupted tabs snapshot, %lld trailing bytes"), Reader.TotalSize() - Reader.Tell());
+		return false;
+	}
+
+	BeginUpdate();
+	ClearTabs();
+
+	const bool bUsesHeaderStrip = UsesHeaderStrip();
+	FGuid ActiveTabId;
+
+	for (int32 SnapshotIndex = 0; SnapshotIndex < SnapshotTabs.Num(); ++SnapshotIndex)
+	{
+		TabbedWidget::FSnapshotTab& SnapshotTab = SnapshotTabs[SnapshotIndex];
+		if (SnapshotTab.ContentClassPath.IsEmpty())
+		{
+			continue;
+		}
+
+		// Lazy like a tab added with a soft content class, so nothing is loaded or built before it is activated.
+		FTabEntry Entry;
+		Entry.TabId = SnapshotTab.TabId;
+		Entry.Label = MoveTemp(SnapshotTab.Label);
+		Entry.SoftContentClass = TSoftClassPtr<UUserWidget>(FSoftObjectPath(SnapshotTab.ContentClassPath));
+		Entry.SavedState = MoveTemp(SnapshotTab.State);
+		Entry.bHasSavedState = SnapshotTab.bHasState;
+
+		if (!bUsesHeaderStrip)
+		{
+			Entry.Header = CreateWidget<UUserWidget>(this, HeaderWidgetClass);
+		}
+
+		UUserWidget* Header = Entry.Header;
+		AddTabEntry(MoveTemp(Entry));
+
+		const int32 TabIndex = FindTabIndexById(SnapshotTab.TabId);
+		if (TabIndex != INDEX_NONE && Header && Header->Implements<UTabHeaderEntryInterface>())
+		{
+			ITabHeaderEntryInterface::Execute_BindToTab(Header, this, TabIndex);
+		}
+
+		if (SnapshotIndex == SnapshotActiveIndex)
+		{
+			ActiveTabId = SnapshotTab.TabId;
+		}
+	}
+
+	const int32 RestoredActiveIndex = FindTabIndexById(ActiveTabId);
+	if (RestoredActiveIndex != INDEX_NONE)
+	{
+		SwitchToTab(RestoredActiveIndex);
+	}
+
+	EndUpdate();
+	return true;
+}
+
+#if WITH_EDITOR
+void UTabbedWidget::ValidateCompiledDefaults(class IWidgetCompilerLog& CompileLog) const
+{
+	Super::ValidateCompiledDefaults(CompileLog);
+#if not UE_BUILD_SHIPPING
+	if (!IsValid(TabHeadersContainer))
+	{
+		auto ResultText = FMessageLog("BlueprintLog").Warning()
+		   ->AddToken(FTextToken::Create(FText::FromString(TEXT("Widget Warning: "))))
+		   ->AddToken(FUObjectToken::Create(this))
+		   ->AddToken(FTextToken::Create(FText::FromString(TEXT(" - TabHeadersContainer should be set for this widget to function properly!"))))
+			->ToText();
+
+		CompileLog.Warning(ResultText);
+	}
+#endif
+}
+
+const FText UTabbedWidget::GetPaletteCategory()
+{
+	return NSLOCTEXT("CommonBasicWidgets", "CommonBasicWidgets", "CommonBasicWidgets");
+}
+#endif
+
+void UTabbedWidget::AddTabEntry(FTabEntry&& Entry)
+{
+	if (!IsValid(TabHeadersContainer) || !IsValid(ContentSwitcher))
+	{
+		UE_LOG(LogTabbedWidget, Error, TEXT("Container widgets not initialized"));
+		return;
+	}
+
+	if (UsesHeaderStrip())
+	{
+		if (Entry.Header)
+		{
+			UE_LOG(LogTabbedWidget, Warning, TEXT("Header widget [%s] is not used, headers are virtualized"), *GetNameSafe(Entry.Header));
+			Entry.Header = nullptr;
+		}
+	}
+	else if (!Entry.Header || !Entry.Header->GetClass()->ImplementsInterface(UTabInterface::StaticClass()))
+	{
+		UE_LOG(LogTabbedWidget, Error, TEXT("Tab header widget must implement ITabInterface"));
+		return;
+	}
+
+	if (Entry.Header && TabIndexByHeader.Contains(Entry.Header))
+	{
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Tab header [%s] was already added"), *GetNameSafe(Entry.Header));
+		return;
+	}
+
+	if (!Entry.TabId.IsValid())
+	{
+		Entry.TabId = FGuid::NewGuid();
+	}
+
+	if (Entry.Content)
+	{
+		Entry.EstimatedBytes = EstimateTabContentBytes(Entry.Content);
+		SuspendTabContent(Entry);
+	}
+	else
+	{
+		Entry.Placeholder = WidgetTree->ConstructWidget<USpacer>();
+	}
+
+	if (Entry.Header)
+	{
+		TabHeadersContainer->AddChild(Entry.Header);
+	}
+	ContentSwitcher->AddChild(Entry.Content ? static_cast<UWidget*>(Entry.Content) : Entry.Placeholder);
+
+	RegisterTabHeader(Entry);
+	const int32 TabIndex = Tabs.Add(MoveTemp(Entry));
+	TabIndexById.Add(Tabs[TabIndex].TabId, TabIndex);
+	if (Tabs[TabIndex].Header)
+	{
+		TabIndexByHeader.Add(Tabs[TabIndex].Header, TabIndex);
+	}
+	bOverflowDirty = true;
+
+	if (ActiveTabIndex == -1)
+	{
+		SwitchToTab(0);
+	}
+	else if (UpdateDepth == 0)
+	{
+		RefreshHeaderStrip();
+	}
+}
+
+void UTabbedWidget::ActivateTab(int32 TabIndex, bool bSwitched)
+{
+	if (!IsValid(ContentSwitcher))
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_TabbedWidgetSwitchToTab);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTabbedWidget::SwitchToTab);
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (!Tabs[TabIndex].IsContentLive())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TabbedWidgetBuildContent);
+		TRACE_CPUPROFILER_EVENT_SCOPE(UTabbedWidget::BuildContent);
+		const double BuildStartTime = FPlatformTime::Seconds();
+
+		if (EnsureTabContent(TabIndex, true))
+		{
+			Tabs[TabIndex].SwitchHistory.Add(ETabSwitchPhase::Construction, TabbedWidget::MillisecondsSince(BuildStartTime));
+		}
+		else if (TabIndex == INDEX_NONE)
+		{
+			// Removed by its own content factory.
+			return;
+		}
+	}
+	Tabs[TabIndex].LastUsed = ++TabUseCounter;
+
+	ActiveTabIndex = TabIndex;
+	if (!StartContentTransition())
+	{
+		DisplayActiveTab();
+	}
+	BringTabHeaderIntoView(TabIndex);
+
+	EvictToBudget();
+
+	// An update that ends on the tab it started on is no switch and would skew the percentiles.
+	if (bSwitched)
+	{
+		LastSwitchLatencyMs = static_cast<float>(TabbedWidget::MillisecondsSince(StartTime));
+		SET_FLOAT_STAT(STAT_TabbedWidgetSwitchLatency, LastSwitchLatencyMs);
+	}
+
+	SchedulePrewarm();
+
+	if (!bSwitched)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_TabbedWidgetListeners);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTabbedWidget::NotifyTabChanged);
+	const double NotifyStartTime = FPlatformTime::Seconds();
+
+	const FGuid TabId = Tabs[TabIndex].TabId;
+	NotifyTabChanged(TabIndex);
+
+	// Listeners may have removed or moved the tab.
+	const int32 NotifiedTabIndex = FindTabIndexById(TabId);
+	if (NotifiedTabIndex != INDEX_NONE)
+	{
+		Tabs[NotifiedTabIndex].SwitchHistory.Add(ETabSwitchPhase::Listeners, TabbedWidget::MillisecondsSince(NotifyStartTime));
+		Tabs[NotifiedTabIndex].SwitchHistory.Add(ETabSwitchPhase::Total, TabbedWidget::MillisecondsSince(StartTime));
+	}
+}
+
+void UTabbedWidget::DisplayActiveTab()
+{
+	const int32 DisplayedTabIndex = FindTabIndexById(DisplayedTabId);
+	if (DisplayedTabIndex != ActiveTabIndex && Tabs.IsValidIndex(DisplayedTabIndex))
+	{
+		SuspendTabContent(Tabs[DisplayedTabIndex]);
+	}
+
+	FTabEntry& Entry = Tabs[ActiveTabIndex];
+	ResumeTabContent(Entry);
+	ContentSwitcher->SetActiveWidgetIndex(ActiveTabIndex);
+
+	const bool bPageChanged = DisplayedTabId != Entry.TabId;
+	DisplayedTabId = Entry.TabId;
+
+	if (!bPageChanged || !Entry.IsContentLive())
+	{
+		return;
+	}
+
+	if (CVarTabbedWidgetMeasurePrepass.GetValueOnGameThread())
+	{
+		// Slate would run it on the next paint, doing it here attributes the cost to the page.
+		SCOPE_CYCLE_COUNTER(STAT_TabbedWidgetLayoutPrepass);
+		TRACE_CPUPROFILER_EVENT_SCOPE(UTabbedWidget::LayoutPrepass);
+		const double PrepassStartTime = FPlatformTime::Seconds();
+
+		Entry.Content->ForceLayoutPrepass();
+		Entry.SwitchHistory.Add(ETabSwitchPhase::Prepass, TabbedWidget::MillisecondsSince(PrepassStartTime));
+	}
+
+	FirstPaintTabId = Entry.TabId;
+	FirstPaintStartTime = FPlatformTime::Seconds();
+}
+
+bool UTabbedWidget::StartContentTransition()
+{
+	const int32 DisplayedTabIndex = FindTabIndexById(DisplayedTabId);
+	if (Transition == ETabTransition::None || DisplayedTabIndex == INDEX_NONE || !ContentSwitcher->GetCachedWidget().IsValid())
+	{
+		StopContentTransition();
+		return false;
+	}
+
+	// Removals may have shifted the page still on screen.
+	ContentSwitcher->SetActiveWidgetIndex(DisplayedTabIndex);
+
+	if (DisplayedTabIndex == ActiveTabIndex)
+	{
+		if (!FWidgetTransitionScheduler::Get().IsRunning(TransitionHandle))
+		{
+			return false;
+		}
+
+		// Back to the page on screen before it was swapped out, it returns from where it is.
+		AnimateContentTransition(1.f);
+		return true;
+	}
+
+	if (TransitionValue >= 1.f)
+	{
+		SlideDirection = ActiveTabIndex > DisplayedTabIndex ? -1.f : 1.f;
+	}
+
+	AnimateContentTransition(0.f);
+	return true;
+}
+
+void UTabbedWidget::AnimateContentTransition(float Target)
+{
+	const float Duration = TransitionSettings.Duration * 0.5f * FMath::Abs(Target - TransitionValue);
+
+	TransitionHandle = FWidgetTransitionScheduler::Get().Animate(TransitionHandle, this, TransitionValue, Target, Duration, TransitionSettings,
+		[this](float Value)
+		{
+			ApplyContentTransition(Value);
+		},
+		[this, Target]()
+		{
+			if (Target > 0.f || !Tabs.IsValidIndex(ActiveTabIndex))
+			{
+				TransitionHandle.Reset();
+				return;
+			}
+
+			// The outgoing page is gone, the active one comes in from the opposite side.
+			DisplayActiveTab();
+			SlideDirection = -SlideDirection;
+			AnimateContentTransition(1.f);
+		});
+}
+
+void UTabbedWidget::ApplyContentTransition(float Value)
+{
+	TransitionValue = Value;
+	ContentSwitcher->SetRenderOpacity(Value);
+
+	if (Transition == ETabTransition::Slide)
+	{
+		ContentSwitcher->SetRenderTranslation(FVector2D((1.f - Value) * SlideDistance * SlideDirection, 0.f));
+	}
+}
+
+void UTabbedWidget::StopContentTransition()
+{
+	FWidgetTransitionScheduler::Get().Stop(TransitionHandle);
+
+	if (TransitionValue < 1.f)
+	{
+		ApplyContentTransition(1.f);
+		ContentSwitcher->SetRenderTranslation(FVector2D::ZeroVector);
+	}
+}
+
+bool UTabbedWidget::EnsureTabContent(int32& TabIndex, bool bHighPriorityLoad)
+{
+	if (Tabs[TabIndex].IsContentLive())
+	{
+		return true;
+	}
+
+	UUserWidget* Content = Tabs[TabIndex].Content;
+	if (!Content)
+	{
+		if (!Tabs[TabIndex].ContentFactory && !ResolveContentClass(TabIndex, bHighPriorityLoad))
+		{
+			// Still streaming in, OnContentClassLoaded builds it.
+			return false;
+		}
+
+		if (Tabs[TabIndex].ContentFactory)
+		{
+			// Run from a copy, the factory may add or remove tabs and reallocate the array holding it.
+			const FGuid TabId = Tabs[TabIndex].TabId;
+			const TFunction<UUserWidget*()> ContentFactory = Tabs[TabIndex].ContentFactory;
+			Content = ContentFactory();
+
+			TabIndex = FindTabIndexById(TabId);
+			if (TabIndex == INDEX_NONE)
+			{
+				UE_LOG(LogTabbedWidget, Warning, TEXT("Tab [%s] was removed while its content was built"), *TabId.ToString());
+				return false;
+			}
+		}
+		else
+		{
+			Content = CreateWidget<UUserWidget>(this, Tabs[TabIndex].ContentClass);
+		}
+	}
+
+	if (!Content)
+	{
+		UE_LOG(LogTabbedWidget, Error, TEXT("Failed to build content of tab %d"), TabIndex);
+		return false;
+	}
+
+	FTabEntry& Entry = Tabs[TabIndex];
+	Entry.Content = Content;
+	Entry.Placeholder = nullptr;
+	Entry.bContentDetached = false;
+	SetSwitcherChild(TabIndex, Content);
+	Entry.EstimatedBytes = EstimateTabContentBytes(Content);
+
+	if (Entry.bHasSavedState && Content->Implements<UTabContentInterface>())
+	{
+		ITabContentInterface::Execute_RestoreTabContentState(Content, Entry.SavedState);
+	}
+
+	Entry.SavedState = FTabContentState();
+	Entry.bHasSavedState = false;
+
+	// Built or attached while inactive, ActivateTab resumes it when the tab is the active one.
+	SuspendTabContent(Entry);
+	return true;
+}
+
+bool UTabbedWidget::ResolveContentClass(int32 TabIndex, bool bHighPriorityLoad)
+{
+	FTabEntry& Entry = Tabs[TabIndex];
+	if (Entry.ContentClass || Entry.SoftContentClass.IsNull())
+	{
+		return true;
+	}
+
+	if (UClass* LoadedClass = Entry.SoftContentClass.Get())
+	{
+		Entry.ContentClass = LoadedClass;
+		return true;
+	}
+
+	if (Entry.LoadHandle.IsValid())
+	{
+		return false;
+	}
+
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	{
+		TGuardValue<bool> RequestGuard(bRequestingContentLoad, true);
+		LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Entry.SoftContentClass.ToSoftObjectPath(),
+			FStreamableDelegate::CreateUObject(this, &UTabbedWidget::OnContentClassLoaded, Entry.TabId),
+			bHighPriorityLoad ? FStreamableManager::AsyncLoadHighPriority : FStreamableManager::DefaultAsyncLoadPriority);
+	}
+
+	// Completed within the request, the caller builds the content.
+	if (Entry.ContentClass)
+	{
+		return true;
+	}
+
+	Entry.LoadHandle = MoveTemp(LoadHandle);
+
+	if (LoadingPlaceholderClass)
+	{
+		if (UUserWidget* LoadingPlaceholder = CreateWidget<UUserWidget>(this, LoadingPlaceholderClass))
+		{
+			Entry.Placeholder = LoadingPlaceholder;
+			SetSwitcherChild(TabIndex, LoadingPlaceholder);
+		}
+	}
+
+	return false;
+}
+
+void UTabbedWidget::OnContentClassLoaded(FGuid TabId)
+{
+	int32 TabIndex = FindTabIndexById(TabId);
+	if (TabIndex == INDEX_NONE)
 	{
-		UE_LOG(LogTabbedWidget, Warning, TEXT("Cannot add tab with null widgets"));
 		return;
 	}
 
-	if (!IsValid(TabHeadersContainer) || !IsValid(ContentSwitcher))
+	FTabEntry& Entry = Tabs[TabIndex];
+	Entry.LoadHandle.Reset();
+	Entry.ContentClass = Entry.SoftContentClass.Get();
+
+	if (!Entry.ContentClass)
 	{
-		UE_LOG(LogTabbedWidget, Error, TEXT("Container widgets not initialized"));
+		UE_LOG(LogTabbedWidget, Error, TEXT("Failed to load content class %s of tab %d"), *Entry.SoftContentClass.ToString(), TabIndex);
 		return;
 	}
 
-	if (!TabHeaderWidget->GetClass()->ImplementsInterface(UTabInterface::StaticClass()))
+	if (bRequestingContentLoad)
 	{
-		UE_LOG(LogTabbedWidget, Error, TEXT("Tab header widget must implement ITabInterface"));
 		return;
 	}
-	
-	TabHeaders.Add(TabHeaderWidget);
-	TabContents.Add(TabContentWidget);
 
-	TabHeadersContainer->AddChild(TabHeaderWidget);
-	ContentSwitcher->AddChild(TabContentWidget);
+	// Requested by an activation or a prewarm, either way it is built now.
+	const double BuildStartTime = FPlatformTime::Seconds();
+	if (Entry.IsContentLive() || !EnsureTabContent(TabIndex))
+	{
+		return;
+	}
+
+	Tabs[TabIndex].LastUsed = ++TabUseCounter;
+	const bool bDisplayed = Tabs[TabIndex].TabId == DisplayedTabId;
+	if (bDisplayed)
+	{
+		Tabs[TabIndex].SwitchHistory.Add(ETabSwitchPhase::Construction, TabbedWidget::MillisecondsSince(BuildStartTime));
+		ResumeTabContent(Tabs[TabIndex]);
+	}
 
-	RegisterTabHeader(TabHeaderWidget);
+	EvictToBudget();
 
-	if (ActiveTabIndex == -1)
+	// A prewarm ran its prepass step while the class was still streaming in, so it runs now.
+	if (!bDisplayed && UpdateDepth == 0 && Tabs[TabIndex].IsContentLive())
 	{
-		SwitchToTab(0);
+		PrewarmSteps.Add({TabIndex, true});
+		StartPrewarmTicker();
 	}
 }
 
-void UTabbedWidget::RemoveTab(int32 TabIndex)
+void UTabbedWidget::CancelContentLoad(FTabEntry& Entry)
 {
-	if (TabIndex < 0 || TabIndex >= TabHeaders.Num())
+	if (Entry.LoadHandle.IsValid())
+	{
+		Entry.LoadHandle->CancelHandle();
+		Entry.LoadHandle.Reset();
+	}
+}
+
+void UTabbedWidget::SuspendTabContent(FTabEntry& Entry)
+{
+	if (!Entry.IsContentLive() || Entry.bContentSuspended)
+	{
+		return;
+	}
+
+	// Collapsed widgets are neither ticked nor painted, which also stops their animations, latent actions and volatile
+	// invalidation. Hidden switcher slots alone still get ticked under global invalidation.
+	Entry.bContentSuspended = true;
+	Entry.ContentVisibility = Entry.Content->GetVisibility();
+	Entry.Content->SetVisibility(ESlateVisibility::Collapsed);
+
+#if !UE_BUILD_SHIPPING && WITH_SLATE_DEBUGGING
+	const TSharedPtr<SWidget> CachedWidget = Entry.Content->GetCachedWidget();
+	Entry.SuspendedPaintFrame = CachedWidget ? CachedWidget->Debug_GetLastPaintFrame() : 0;
+#endif
+
+	if (Entry.Content->Implements<UTabContentInterface>())
+	{
+		ITabContentInterface::Execute_OnTabContentDeactivated(Entry.Content);
+	}
+}
+
+void UTabbedWidget::ResumeTabContent(FTabEntry& Entry)
+{
+	if (!Entry.IsContentLive() || !Entry.bContentSuspended)
 	{
-		UE_LOG(LogTabbedWidget, Warning, TEXT("Invalid tab index: %d"), TabIndex);
 		return;
 	}
 
-	UUserWidget* HeaderToRemove = TabHeaders[TabIndex];
-	UUserWidget* ContentToRemove = TabContents[TabIndex];
+	Entry.bContentSuspended = false;
+	Entry.Content->SetVisibility(Entry.ContentVisibility);
+
+	if (Entry.Content->Implements<UTabContentInterface>())
+	{
+		ITabContentInterface::Execute_OnTabContentActivated(Entry.Content);
+	}
+}
+
+void UTabbedWidget::CountSuspendedWork()
+{
+#if !UE_BUILD_SHIPPING && WITH_SLATE_DEBUGGING
+	for (FTabEntry& Entry : Tabs)
+	{
+		if (!Entry.bContentSuspended || !Entry.IsContentLive())
+		{
+			continue;
+		}
+
+		const TSharedPtr<SWidget> CachedWidget = Entry.Content->GetCachedWidget();
+		const uint32 PaintFrame = CachedWidget ? CachedWidget->Debug_GetLastPaintFrame() : 0;
+		const bool bPainted = PaintFrame != Entry.SuspendedPaintFrame;
+		Entry.SuspendedPaintFrame = PaintFrame;
+
+		// Animations are advanced by the sequence tick manager outside of the widget tick, so they are checked on their own.
+		// NativeTick and latent actions can't be observed from here, they stop because collapsed widgets are not ticked.
+		if (bPainted || Entry.Content->IsAnyAnimationPlaying())
+		{
+			++Entry.SuspendedWorkCount;
+		}
+	}
+#endif
+}
 
-	TabHeadersContainer->RemoveChild(HeaderToRemove);
-	ContentSwitcher->RemoveChild(ContentToRemove);
+void UTabbedWidget::SetSwitcherChild(int32 TabIndex, UWidget* Widget)
+{
+	if (UWidget* PreviousWidget = ContentSwitcher->GetChildAt(TabIndex))
+	{
+		PreviousWidget->Slot = nullptr;
+	}
 
-	TabHeaders.RemoveAt(TabIndex);
-	TabContents.RemoveAt(TabIndex);
+	ContentSwitcher->ReplaceChildAt(TabIndex, Widget);
 
-	UnregisterTabHeader(HeaderToRemove);
+	// ReplaceChildAt only updates the UMG side, the Slate slot is pointed at the new widget here.
+	if (UWidgetSwitcherSlot* SwitcherSlot = Cast<UWidgetSwitcherSlot>(Widget->Slot))
+	{
+		SwitcherSlot->SetContent(Widget);
+	}
+}
 
-	if (TabHeaders.Num() == 0)
+void UTabbedWidget::EvictToBudget()
+{
+	if (MaxLiveTabs <= 0 && MaxLiveContentBytes <= 0)
 	{
-		ActiveTabIndex = -1;
 		return;
 	}
 
-	if (TabIndex <= ActiveTabIndex)
+	int32 LiveTabs = 0;
+	int64 LiveBytes = 0;
+	for (const FTabEntry& Entry : Tabs)
+	{
+		if (Entry.IsContentLive())
+		{
+			++LiveTabs;
+			LiveBytes += Entry.EstimatedBytes;
+		}
+	}
+
+	const auto IsOverBudget = [this, &LiveTabs, &LiveBytes]()
+	{
+		return (MaxLiveTabs > 0 && LiveTabs > MaxLiveTabs) || (MaxLiveContentBytes > 0 && LiveBytes > MaxLiveContentBytes);
+	};
+
+	// Linear in tabs per eviction, which stays cheap for the handful of tabs over budget at a time.
+	while (IsOverBudget())
 	{
-		const int32 NewActiveIndex = FMath::Clamp(ActiveTabIndex - 1, 0, TabHeaders.Num() - 1);
-		SwitchToTab(NewActiveIndex);
+		int32 OldestTab = INDEX_NONE;
+		for (int32 TabIndex = 0; TabIndex < Tabs.Num(); ++TabIndex)
+		{
+			const bool bCandidate = TabIndex != ActiveTabIndex && Tabs[TabIndex].TabId != DisplayedTabId && Tabs[TabIndex].IsContentLive();
+			if (bCandidate && (OldestTab == INDEX_NONE || Tabs[TabIndex].LastUsed < Tabs[OldestTab].LastUsed))
+			{
+				OldestTab = TabIndex;
+			}
+		}
+
+		if (OldestTab == INDEX_NONE)
+		{
+			return;
+		}
+
+		--LiveTabs;
+		LiveBytes -= Tabs[OldestTab].EstimatedBytes;
+		EvictTabContent(OldestTab);
 	}
 }
 
-void UTabbedWidget::SwitchToTab(int32 TabIndex)
+int32 UTabbedWidget::CountLiveTabs() const
 {
-	if (TabIndex < 0 || TabIndex >= TabHeaders.Num())
+	int32 LiveTabs = 0;
+	for (const FTabEntry& Entry : Tabs)
 	{
-		UE_LOG(LogTabbedWidget, Warning, TEXT("Invalid tab index: %d"), TabIndex);
+		LiveTabs += Entry.IsContentLive() ? 1 : 0;
+	}
+
+	return LiveTabs;
+}
+
+void UTabbedWidget::SchedulePrewarm()
+{
+	if (UpdateDepth > 0)
+	{
+		// EndUpdate schedules again once indices settle.
 		return;
 	}
 
-	if (!IsValid(ContentSwitcher))
+	PrewarmSteps.Reset();
+
+	if (bPrewarmAdjacentTabs)
 	{
+		// A prewarmed tab beyond MaxLiveTabs would be the next one evicted, or push out one the user visited.
+		int32 FreeLiveTabs = MaxLiveTabs > 0 ? MaxLiveTabs - CountLiveTabs() : MAX_int32;
+
+		// The next tab first, users move forward more often than back.
+		for (const int32 TabIndex : {ActiveTabIndex + 1, ActiveTabIndex - 1})
+		{
+			if (FreeLiveTabs > 0 && Tabs.IsValidIndex(TabIndex) && !Tabs[TabIndex].IsContentLive())
+			{
+				PrewarmSteps.Add({TabIndex, false});
+				PrewarmSteps.Add({TabIndex, true});
+				--FreeLiveTabs;
+			}
+		}
+	}
+
+	if (PrewarmSteps.Num() == 0)
+	{
+		CancelPrewarm();
 		return;
 	}
 
-	ContentSwitcher->SetActiveWidgetIndex(TabIndex);
-	ActiveTabIndex = TabIndex;
+	StartPrewarmTicker();
+}
 
-	NotifyTabChanged(TabIndex);
+void UTabbedWidget::StartPrewarmTicker()
+{
+	if (!PrewarmTickerHandle.IsValid())
+	{
+		PrewarmTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UTabbedWidget::TickPrewarm), 0.0f);
+	}
 }
 
-int32 UTabbedWidget::GetActiveTabIndex() const
+void UTabbedWidget::CancelPrewarm()
 {
-	return ActiveTabIndex;
+	PrewarmSteps.Reset();
+
+	if (PrewarmTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PrewarmTickerHandle);
+		PrewarmTickerHandle.Reset();
+	}
 }
 
-int32 UTabbedWidget::GetTabCount() const
+bool UTabbedWidget::TickPrewarm(float DeltaTime)
 {
-	return TabHeaders.Num();
+	SCOPE_CYCLE_COUNTER(STAT_TabbedWidgetPrewarm);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = PrewarmBudgetMs / 1000.0;
+
+	while (PrewarmSteps.Num() > 0)
+	{
+		const FPrewarmStep Step = PrewarmSteps[0];
+		PrewarmSteps.RemoveAt(0, 1, EAllowShrinking::No);
+		RunPrewarmStep(Step);
+
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	if (PrewarmSteps.Num() == 0)
+	{
+		PrewarmTickerHandle.Reset();
+		return false;
+	}
+
+	return true;
 }
 
-void UTabbedWidget::ClearTabs()
+void UTabbedWidget::RunPrewarmStep(const FPrewarmStep& Step)
 {
-	for (int32 i = 0; i < GetTabCount(); ++i)
+	if (!Tabs.IsValidIndex(Step.TabIndex))
+	{
+		return;
+	}
+
+	if (!Step.bPrepass)
+	{
+		// Tabs activated since scheduling may have used up the live tab budget.
+		if (MaxLiveTabs > 0 && CountLiveTabs() >= MaxLiveTabs)
+		{
+			return;
+		}
+
+		int32 TabIndex = Step.TabIndex;
+		if (EnsureTabContent(TabIndex))
+		{
+			Tabs[TabIndex].LastUsed = ++TabUseCounter;
+			EvictToBudget();
+		}
+		return;
+	}
+
+	// Builds the Slate tree and caches desired sizes, the part of a first switch that construction leaves over.
+	if (Tabs[Step.TabIndex].IsContentLive())
 	{
-		RemoveTab(i);
+		Tabs[Step.TabIndex].Content->ForceLayoutPrepass();
 	}
 }
 
-#if WITH_EDITOR
-void UTabbedWidget::ValidateCompiledDefaults(class IWidgetCompilerLog& CompileLog) const
+void UTabbedWidget::NativeOnInitialized()
 {
-	Super::ValidateCompiledDefaults(CompileLog);
-#if not UE_BUILD_SHIPPING
-	if (!IsValid(TabHeadersContainer))
+	Super::NativeOnInitialized();
+
+	if (IsValid(OverflowComboBox))
 	{
-		auto ResultText = FMessageLog("BlueprintLog").Warning()
-		   ->AddToken(FTextToken::Create(FText::FromString(TEXT("Widget Warning: "))))
-		   ->AddToken(FUObjectToken::Create(this))
-		   ->AddToken(FTextToken::Create(FText::FromString(TEXT(" - TabHeadersContainer should be set for this widget to function properly!"))))
-			->ToText();
+		OverflowComboBox->OnSelectionChanged.AddDynamic(this, &UTabbedWidget::OnOverflowSelectionChanged);
+		OverflowComboBox->OnOpening.AddDynamic(this, &UTabbedWidget::OnOverflowOpening);
+		if (!OverflowComboBox->OnGenerateWidgetEvent.IsBound())
+		{
+			OverflowComboBox->OnGenerateWidgetEvent.BindDynamic(this, &UTabbedWidget::GenerateOverflowOption);
+		}
+		OverflowComboBox->SetVisibility(ESlateVisibility::Collapsed);
+	}
+}
 
-		CompileLog.Warning(ResultText);
+void UTabbedWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	CountSuspendedWork();
+	RecordFirstPaint();
+
+	if (!UsesHeaderStrip())
+	{
+		return;
+	}
+
+	const int32 Capacity = ComputeHeaderStripCapacity();
+	if (Capacity != HeaderStripCapacity)
+	{
+		HeaderStripCapacity = Capacity;
+		BringTabHeaderIntoView(ActiveTabIndex);
 	}
-#endif
 }
 
-const FText UTabbedWidget::GetPaletteCategory()
+int32 UTabbedWidget::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
-	return NSLOCTEXT("CommonBasicWidgets", "CommonBasicWidgets", "CommonBasicWidgets");
+	// Runs after the children were painted, the next tick records it.
+	if (FirstPaintTabId.IsValid())
+	{
+		LastPaintTime = FPlatformTime::Seconds();
+	}
+
+	return Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+}
+
+void UTabbedWidget::RecordFirstPaint()
+{
+	if (!FirstPaintTabId.IsValid() || LastPaintTime < FirstPaintStartTime)
+	{
+		return;
+	}
+
+	const float FirstPaintMs = static_cast<float>((LastPaintTime - FirstPaintStartTime) * 1000.0);
+	SET_FLOAT_STAT(STAT_TabbedWidgetFirstPaint, FirstPaintMs);
+
+	const int32 TabIndex = FindTabIndexById(FirstPaintTabId);
+	if (TabIndex != INDEX_NONE)
+	{
+		Tabs[TabIndex].SwitchHistory.Add(ETabSwitchPhase::FirstPaint, FirstPaintMs);
+	}
+
+	FirstPaintTabId.Invalidate();
+}
+
+void UTabbedWidget::BeginDestroy()
+{
+	CancelPrewarm();
+	for (FTabEntry& Entry : Tabs)
+	{
+		CancelContentLoad(Entry);
+	}
+	FWidgetTransitionScheduler::Get().Stop(TransitionHandle);
+
+	Super::BeginDestroy();
+}
+
+int64 UTabbedWidget::EstimateTabContentBytes(const UUserWidget* Content) const
+{
+	int64 Bytes = Content->GetClass()->GetStructureSize();
+	if (Content->WidgetTree)
+	{
+		Content->WidgetTree->ForEachWidget([&Bytes](const UWidget* Widget)
+		{
+			Bytes += Widget->GetClass()->GetStructureSize();
+		});
+	}
+
+	return Bytes;
 }
-#endif
 
-void UTabbedWidget::RegisterTabHeader(UUserWidget* TabHeaderWidget)
+void UTabbedWidget::RegisterTabHeader(FTabEntry& Entry)
 {
-	if (!IsValid(TabHeaderWidget) || !TabHeaderWidget->Implements<UTabInterface>())
+	if (!IsValid(Entry.Header) || !Entry.Header->Implements<UTabInterface>())
 	{
 		return;
 	}
-	
-	OnClickedDelegate.BindDynamic(this, &UTabbedWidget::OnTabClicked);
-	ITabInterface::Execute_BindOnClick(TabHeaderWidget, OnClickedDelegate);
+
+	Entry.ClickProxy = NewObject<UTabHeaderClickProxy>(this);
+	Entry.ClickProxy->Init(this, Entry.TabId);
+	ITabInterface::Execute_BindOnClick(Entry.Header, Entry.ClickProxy->GetClickedEvent());
 }
 
-void UTabbedWidget::UnregisterTabHeader(UUserWidget* TabHeaderWidget)
+void UTabbedWidget::UnregisterTabHeader(FTabEntry& Entry)
 {
-	if (!IsValid(TabHeaderWidget) || !TabHeaderWidget->Implements<UTabInterface>())
+	TabIndexById.Remove(Entry.TabId);
+	TabIndexByHeader.Remove(Entry.Header);
+
+	if (!IsValid(Entry.Header) || !Entry.Header->Implements<UTabInterface>() || !Entry.ClickProxy)
 	{
 		return;
 	}
 
-	ITabInterface::Execute_UnbindOnClick(TabHeaderWidget, OnClickedDelegate);
-	OnClickedDelegate.Unbind();
+	// Only this header's own binding goes away, the other headers keep theirs.
+	ITabInterface::Execute_UnbindOnClick(Entry.Header, Entry.ClickProxy->GetClickedEvent());
+	Entry.ClickProxy->GetClickedEvent().Unbind();
+	Entry.ClickProxy = nullptr;
+}
+
+void UTabbedWidget::ReindexTabs(int32 FirstTabIndex)
+{
+	for (int32 TabIndex = FirstTabIndex; TabIndex < Tabs.Num(); ++TabIndex)
+	{
+		TabIndexById.Add(Tabs[TabIndex].TabId, TabIndex);
+		if (Tabs[TabIndex].Header)
+		{
+			TabIndexByHeader.Add(Tabs[TabIndex].Header, TabIndex);
+		}
+	}
 }
 
 void UTabbedWidget::NotifyTabChanged(int32 NewTabIndex)
@@ -165,31 +1578,218 @@ void UTabbedWidget::NotifyTabChanged(int32 NewTabIndex)
 	OnTabChanged.Broadcast(NewTabIndex);
 }
 
-void UTabbedWidget::OnTabClicked(TScriptInterface<ITabInterface> TabHeader)
+void UTabbedWidget::OnTabClicked(const FGuid& TabId)
 {
-	if (!IsValid(TabHeader.GetObject()))
+	const int32 Index = FindTabIndexById(TabId);
+	if (Index == INDEX_NONE)
 	{
-		UE_LOG(LogTabbedWidget, Warning, TEXT("Invalid tab header interface was given to event!"));
+		UE_LOG(LogTabbedWidget, Warning, TEXT("Couldn't find clicked tab [%s]"), *TabId.ToString());
 		return;
 	}
 
-	const auto AsWidget = CastChecked<UUserWidget>(TabHeader.GetObject());
-	const auto Index = GetTabIndex(AsWidget);
-	if (Index == INDEX_NONE)
+	SwitchToTab(Index);
+}
+
+int32 UTabbedWidget::ComputeHeaderStripCapacity() const
+{
+	// Zero until the container was arranged once, the strip stays empty for that frame.
+	const float StripWidth = IsValid(TabHeadersContainer) ? TabHeadersContainer->GetCachedGeometry().GetLocalSize().X : 0.f;
+	return StripWidth > 0.f ? FMath::Max(1, FMath::FloorToInt32(StripWidth / HeaderExtent)) : 0;
+}
+
+void UTabbedWidget::BringTabHeaderIntoView(int32 TabIndex)
+{
+	const int32 NumVisible = FMath::Min(HeaderStripCapacity, Tabs.Num());
+	if (Tabs.IsValidIndex(TabIndex) && NumVisible > 0)
+	{
+		if (TabIndex < HeaderStripFirst)
+		{
+			HeaderStripFirst = TabIndex;
+		}
+		else if (TabIndex >= HeaderStripFirst + NumVisible)
+		{
+			HeaderStripFirst = TabIndex - NumVisible + 1;
+		}
+	}
+
+	RefreshHeaderStrip();
+}
+
+void UTabbedWidget::RefreshHeaderStrip()
+{
+	if (!UsesHeaderStrip() || !IsValid(TabHeadersContainer))
 	{
-		UE_LOG(LogTabbedWidget, Warning, TEXT("Couldn't find widget in tab headers. Widget [%s]"), *GetNameSafe(AsWidget));
 		return;
 	}
 
-	SwitchToTab(Index);
+	const int32 NumVisible = FMath::Min(HeaderStripCapacity, Tabs.Num());
+	HeaderStripFirst = FMath::Clamp(HeaderStripFirst, 0, Tabs.Num() - NumVisible);
+
+	// Slot order is strip order, so scrolling rebinds the same headers instead of moving them.
+	int32 NumBound = 0;
+	for (; NumBound < NumVisible; ++NumBound)
+	{
+		if (!HeaderStripSlots.IsValidIndex(NumBound) && !AddHeaderStripSlot())
+		{
+			break;
+		}
+
+		BindHeaderStripSlot(HeaderStripSlots[NumBound], HeaderStripFirst + NumBound);
+	}
+
+	for (int32 SlotIndex = NumBound; SlotIndex < HeaderStripSlots.Num(); ++SlotIndex)
+	{
+		ReleaseHeaderStripSlot(HeaderStripSlots[SlotIndex]);
+	}
+
+	// The options themselves are only built when the dropdown opens, scrolling the strip stays O(headers).
+	if (OverflowWindowFirst != HeaderStripFirst || OverflowWindowEnd != HeaderStripFirst + NumBound)
+	{
+		OverflowWindowFirst = HeaderStripFirst;
+		OverflowWindowEnd = HeaderStripFirst + NumBound;
+		bOverflowDirty = true;
+	}
+
+	if (IsValid(OverflowComboBox))
+	{
+		const ESlateVisibility OverflowVisibility = NumBound < Tabs.Num() ? ESlateVisibility::Visible : ESlateVisibility::Collapsed;
+		if (OverflowComboBox->GetVisibility() != OverflowVisibility)
+		{
+			OverflowComboBox->SetVisibility(OverflowVisibility);
+		}
+	}
+}
+
+bool UTabbedWidget::AddHeaderStripSlot()
+{
+	UUserWidget* Header = CreateWidget<UUserWidget>(this, HeaderWidgetClass);
+	if (!Header || !Header->Implements<UTabInterface>())
+	{
+		UE_LOG(LogTabbedWidget, Error, TEXT("Header widget class must implement ITabInterface"));
+		return false;
+	}
+
+	// Every header takes exactly HeaderExtent, which is what the strip capacity is computed from.
+	USizeBox* SizeBox = WidgetTree->ConstructWidget<USizeBox>();
+	SizeBox->SetWidthOverride(HeaderExtent);
+	SizeBox->AddChild(Header);
+
+	FTabHeaderStripSlot& StripSlot = HeaderStripSlots.AddDefaulted_GetRef();
+	StripSlot.Header = Header;
+	StripSlot.SizeBox = SizeBox;
+	StripSlot.ClickProxy = NewObject<UTabHeaderClickProxy>(this);
+	StripSlot.ClickProxy->Init(this, FGuid());
+	ITabInterface::Execute_BindOnClick(Header, StripSlot.ClickProxy->GetClickedEvent());
+
+	TabHeadersContainer->AddChild(SizeBox);
+	return true;
+}
+
+void UTabbedWidget::BindHeaderStripSlot(FTabHeaderStripSlot& StripSlot, int32 TabIndex)
+{
+	const FTabEntry& Entry = Tabs[TabIndex];
+	const bool bActive = TabIndex == ActiveTabIndex;
+	const bool bImplementsEntry = StripSlot.Header->Implements<UTabHeaderEntryInterface>();
+
+	if (StripSlot.TabIndex != TabIndex || StripSlot.TabId != Entry.TabId)
+	{
+		StripSlot.TabIndex = TabIndex;
+		StripSlot.TabId = Entry.TabId;
+		StripSlot.ClickProxy->SetTabId(Entry.TabId);
+		StripSlot.SizeBox->SetVisibility(ESlateVisibility::Visible);
+
+		if (bImplementsEntry)
+		{
+			ITabHeaderEntryInterface::Execute_BindToTab(StripSlot.Header, this, TabIndex);
+			ITabHeaderEntryInterface::Execute_SetTabHeaderActive(StripSlot.Header, bActive);
+		}
+		StripSlot.bActive = bActive;
+		return;
+	}
+
+	if (StripSlot.bActive != bActive)
+	{
+		StripSlot.bActive = bActive;
+		if (bImplementsEntry)
+		{
+			ITabHeaderEntryInterface::Execute_SetTabHeaderActive(StripSlot.Header, bActive);
+		}
+	}
+}
+
+void UTabbedWidget::ReleaseHeaderStripSlot(FTabHeaderStripSlot& StripSlot)
+{
+	if (!StripSlot.TabId.IsValid())
+	{
+		return;
+	}
+
+	StripSlot.TabIndex = INDEX_NONE;
+	StripSlot.TabId.Invalidate();
+	StripSlot.bActive = false;
+	StripSlot.ClickProxy->SetTabId(FGuid());
+	StripSlot.SizeBox->SetVisibility(ESlateVisibility::Collapsed);
+
+	if (StripSlot.Header->Implements<UTabHeaderEntryInterface>())
+	{
+		ITabHeaderEntryInterface::Execute_OnTabHeaderReleased(StripSlot.Header);
+	}
+}
+
+void UTabbedWidget::RebuildOverflowOptions()
+{
+	bOverflowDirty = false;
+	OverflowTabIndices.Reset();
+
+	if (!IsValid(OverflowComboBox))
+	{
+		return;
+	}
+
+	OverflowComboBox->ClearOptions();
+	for (int32 TabIndex = 0; TabIndex < Tabs.Num(); ++TabIndex)
+	{
+		if (TabIndex < OverflowWindowFirst || TabIndex >= OverflowWindowEnd)
+		{
+			// Options are only tab numbers, unique for the combo box, rows read the label from Tabs when generated.
+			OverflowTabIndices.Add(TabIndex);
+			OverflowComboBox->AddOption(FString::FromInt(TabIndex + 1));
+		}
+	}
+}
+
+void UTabbedWidget::OnOverflowOpening()
+{
+	if (bOverflowDirty)
+	{
+		RebuildOverflowOptions();
+	}
+}
+
+UWidget* UTabbedWidget::GenerateOverflowOption(FString Item)
+{
+	const int32 TabIndex = FCString::Atoi(*Item) - 1;
+
+	UTextBlock* TextBlock = WidgetTree->ConstructWidget<UTextBlock>();
+	TextBlock->SetText(FText::Format(NSLOCTEXT("CommonBasicWidgets", "OverflowTabOption", "{0}. {1}"), TabIndex + 1, GetTabLabel(TabIndex)));
+	return TextBlock;
 }
 
-int32 UTabbedWidget::GetTabIndex(UUserWidget* TabWidget) const noexcept
+void UTabbedWidget::OnOverflowSelectionChanged(FString SelectedItem, ESelectInfo::Type SelectionType)
 {
-	if (!IsValid(TabWidget))
+	// Direct changes come from rebuilding the options.
+	if (SelectionType == ESelectInfo::Direct)
+	{
+		return;
+	}
+
+	const int32 OptionIndex = OverflowComboBox->GetSelectedIndex();
+	if (!OverflowTabIndices.IsValidIndex(OptionIndex))
 	{
-		return INDEX_NONE;
+		return;
 	}
 
-	return TabHeaders.Find(TabWidget);
+	const int32 TabIndex = OverflowTabIndices[OptionIndex];
+	OverflowComboBox->ClearSelection();
+	SwitchToTab(TabIndex);
 }
@@ -0,0 +1,238 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "WidgetTransition/WidgetTransitionScheduler.h"
+
+#include "Kismet/KismetMathLibrary.h"
+
+DECLARE_CYCLE_STAT(TEXT("Widget Transitions"), STAT_WidgetTransitionScheduler, STATGROUP_Slate);
+
+FWidgetTransitionScheduler& FWidgetTransitionScheduler::Get()
+{
+	static FWidgetTransitionScheduler Scheduler;
+	return Scheduler;
+}
+
+FWidgetTransitionHandle FWidgetTransitionScheduler::Animate(FWidgetTransitionHandle InHandle, const UObject* InOwner, float InFrom, float InTo, float InDuration,
+	const FWidgetTransitionSettings& InSettings, FApplyFunc&& InApply, FFinishedFunc&& InOnFinished)
+{
+	check(IsInGameThread());
+
+	if (!InHandle.IsValid())
+	{
+		// Zero is the invalid id, it is skipped when the counter wraps around.
+		InHandle.Id = ++LastId != 0 ? LastId : ++LastId;
+	}
+
+	FTransition Request;
+	Request.Id = InHandle.Id;
+	Request.Owner = InOwner;
+	Request.From = InFrom;
+	Request.To = InTo;
+	Request.Duration = FMath::Max(InDuration, 0.f);
+	Request.EasingFunction = InSettings.EasingFunction;
+	Request.ExponentForEasing = InSettings.ExponentForEasing;
+	Request.Apply = MoveTemp(InApply);
+	Request.OnFinished = MoveTemp(InOnFinished);
+
+	if (bTicking)
+	{
+		// Retargeting a transition that finished this frame replaces its finished callback too.
+		CancelFinishedCallback(Request.Id);
+		PendingTransitions.RemoveAll([Id = Request.Id](const FTransition& Pending) { return Pending.Id == Id; });
+		PendingTransitions.Add(MoveTemp(Request));
+	}
+	else
+	{
+		StartOrRetarget(MoveTemp(Request));
+	}
+
+	return InHandle;
+}
+
+void FWidgetTransitionScheduler::Stop(FWidgetTransitionHandle& InOutHandle)
+{
+	if (!InOutHandle.IsValid())
+	{
+		return;
+	}
+
+	PendingTransitions.RemoveAll([Id = InOutHandle.Id](const FTransition& Pending) { return Pending.Id == Id; });
+	CancelFinishedCallback(InOutHandle.Id);
+
+	if (const int32* Index = TransitionIndexById.Find(InOutHandle.Id))
+	{
+		if (bTicking)
+		{
+			Transitions[*Index].bStopped = true;
+		}
+		else
+		{
+			RemoveAtSwap(*Index);
+		}
+	}
+
+	InOutHandle.Reset();
+}
+
+bool FWidgetTransitionScheduler::IsRunning(FWidgetTransitionHandle InHandle) const
+{
+	if (const int32* Index = TransitionIndexById.Find(InHandle.Id))
+	{
+		if (!Transitions[*Index].bStopped)
+		{
+			return true;
+		}
+	}
+
+	// Finished this frame, but still running until its callback was called.
+	if (FinishedCallbacks.ContainsByPredicate([Id = InHandle.Id](const FFinishedCallback& Finished) { return Finished.Key == Id; }))
+	{
+		return true;
+	}
+
+	return PendingTransitions.ContainsByPredicate([Id = InHandle.Id](const FTransition& Pending) { return Pending.Id == Id; });
+}
+
+void FWidgetTransitionScheduler::Shutdown()
+{
+	check(IsInGameThread());
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// Applied values stay where they are, nothing is called back into code that may be unloaded with the module.
+	Transitions.Empty();
+	TransitionIndexById.Empty();
+	PendingTransitions.Empty();
+	FinishedCallbacks.Empty();
+}
+
+int32 FWidgetTransitionScheduler::GetNumRunning() const
+{
+	return Transitions.Num() + PendingTransitions.Num();
+}
+
+void FWidgetTransitionScheduler::StartOrRetarget(FTransition&& Request)
+{
+	if (const int32* Index = TransitionIndexById.Find(Request.Id))
+	{
+		FTransition& Transition = Transitions[*Index];
+		if (!Transition.bStopped)
+		{
+			Request.From = Transition.Value;
+		}
+
+		Request.Value = Request.From;
+		Transition = MoveTemp(Request);
+	}
+	else
+	{
+		Request.Value = Request.From;
+		TransitionIndexById.Add(Request.Id, Transitions.Add(MoveTemp(Request)));
+	}
+
+	// Registered once and kept, an idle tick is cheaper than adding and removing the ticker around every burst.
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FWidgetTransitionScheduler::Tick), 0.0f);
+	}
+}
+
+void FWidgetTransitionScheduler::CancelFinishedCallback(uint32 InId)
+{
+	for (FFinishedCallback& Finished : FinishedCallbacks)
+	{
+		if (Finished.Key == InId)
+		{
+			Finished.Key = 0;
+			Finished.Value = nullptr;
+		}
+	}
+}
+
+void FWidgetTransitionScheduler::RemoveAtSwap(int32 Index)
+{
+	TransitionIndexById.Remove(Transitions[Index].Id);
+	Transitions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (Transitions.IsValidIndex(Index))
+	{
+		TransitionIndexById.Add(Transitions[Index].Id, Index);
+	}
+}
+
+bool FWidgetTransitionScheduler::Tick(float DeltaTime)
+{
+	if (Transitions.Num() == 0)
+	{
+		return true;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_WidgetTransitionScheduler);
+
+	bTicking = true;
+
+	for (FTransition& Transition : Transitions)
+	{
+		if (Transition.bStopped)
+		{
+			continue;
+		}
+
+		if (!Transition.Owner.IsValid())
+		{
+			Transition.bStopped = true;
+			continue;
+		}
+
+		Transition.Elapsed += DeltaTime;
+		const float Alpha = Transition.Duration > 0.f ? FMath::Clamp(Transition.Elapsed / Transition.Duration, 0.f, 1.f) : 1.f;
+		Transition.Value = Alpha < 1.f ? UKismetMathLibrary::Ease(Transition.From, Transition.To, Alpha, Transition.EasingFunction, Transition.ExponentForEasing) : Transition.To;
+		Transition.Apply(Transition.Value);
+
+		if (Alpha >= 1.f)
+		{
+			Transition.bStopped = true;
+			if (Transition.OnFinished)
+			{
+				FinishedCallbacks.Emplace(Transition.Id, MoveTemp(Transition.OnFinished));
+			}
+		}
+	}
+
+	for (int32 Index = Transitions.Num() - 1; Index >= 0; --Index)
+	{
+		if (Transitions[Index].bStopped)
+		{
+			RemoveAtSwap(Index);
+		}
+	}
+
+	// Callbacks may stop transitions that finished in the same frame, those are skipped. Indexed, entries are only cleared meanwhile.
+	for (int32 Index = 0; Index < FinishedCallbacks.Num(); ++Index)
+	{
+		if (FinishedCallbacks[Index].Key == 0)
+		{
+			continue;
+		}
+
+		const FFinishedFunc OnFinished = MoveTemp(FinishedCallbacks[Index].Value);
+		FinishedCallbacks[Index].Key = 0;
+		OnFinished();
+	}
+	FinishedCallbacks.Reset();
+
+	bTicking = false;
+
+	for (FTransition& Pending : PendingTransitions)
+	{
+		StartOrRetarget(MoveTemp(Pending));
+	}
+	PendingTransitions.Reset();
+
+	return true;
+}
@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IndexedListPagedDataSource.h"
+#include "IndexedListFakePagedDataSource.generated.h"
+
+UCLASS(BlueprintType)
+class COMMONBASICWIDGETS_API UIndexedListFakeRow : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "Fake Row")
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Fake Row")
+	FText Label;
+};
+
+/**
+ * In-process provider that answers page requests with generated rows after a simulated latency.
+ * Lets paged lists be exercised without a backend.
+ */
+UCLASS(meta=(DisplayName="Fake Paged Data Source"))
+class COMMONBASICWIDGETS_API UIndexedListFakePagedDataSource : public UIndexedListPagedDataSource
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintPure, Category = "Fake Data Source")
+	int32 GetNumRequestedPages() const noexcept;
+
+protected:
+	virtual void RequestPage_Implementation(int32 InPageIndex, int32 InFirstIndex, int32 InCount, int32 InRequestId) override;
+	virtual void BeginDestroy() override;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0.0", Units="s"), Category = "Fake Data Source")
+	float SimulatedLatency = 0.25f;
+
+	/** Random extra latency added on top of SimulatedLatency, so pages may complete out of order. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0.0", Units="s"), Category = "Fake Data Source")
+	float LatencyJitter = 0.1f;
+
+	/** Chance for a request to fail, to exercise the retry backoff of the base class. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0.0", ClampMax="1.0"), Category = "Fake Data Source")
+	float FailureRate = 0.f;
+
+private:
+	/** By request id, a page requested again has one ticker per request. */
+	TMap<int32, FTSTicker::FDelegateHandle> PendingTickers;
+	int32 NumRequestedPages = 0;
+
+	void CompleteRequest(int32 InPageIndex, int32 InFirstIndex, int32 InCount, int32 InRequestId);
+};
@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Wrapping layout of uniform tiles. The column count follows the viewport width and every query is O(1).
+ * Positions of the materialized rows are computed in one pass into structure-of-arrays buffers,
+ * so placing an entry is two loads instead of per-widget layout.
+ */
+class COMMONBASICWIDGETS_API FIndexedListGridLayout
+{
+public:
+	/** Returns whether the column count changed. */
+	bool Configure(double InViewportWidth, const FVector2D& InTileSize, const FVector2D& InSpacing);
+
+	int32 GetNumColumns() const noexcept { return NumColumns; }
+	const FVector2D& GetTileSize() const noexcept { return TileSize; }
+
+	double GetLineTop(int32 InRow) const { return static_cast<double>(InRow / NumColumns) * LineStride; }
+	double GetContentExtent(int32 InNumRows) const;
+
+	/** Rows of the lines overlapping [InTop, InBottom), widened by InOverscanLines on both sides. */
+	bool GetRowsInRange(double InTop, double InBottom, int32 InNumRows, int32 InOverscanLines, int32& OutFirstRow, int32& OutEndRow) const;
+
+	/** First row of the line at the offset, clamped to the valid rows. */
+	int32 FindRowAtOffset(double InOffset, int32 InNumRows) const;
+
+	/** Lays out rows [InFirstRow, InEndRow). */
+	void Compute(int32 InFirstRow, int32 InEndRow);
+
+	/** Content space position of a row inside the last computed range. */
+	FVector2D GetPosition(int32 InRow) const;
+
+private:
+	FVector2D TileSize = FVector2D(1.0, 1.0);
+	int32 NumColumns = 1;
+	double ColumnStride = 1.0;
+	double LineStride = 1.0;
+
+	int32 ComputedFirstRow = 0;
+	double ComputedTop = 0.0;
+	TArray<float> PositionsX;
+	/** Relative to ComputedTop, so large lists keep float precision. */
+	TArray<float> PositionsY;
+};
@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Prefix sums of row heights stored as a Fenwick tree.
+ * Offset of a row, row at an offset and height updates are O(log n).
+ * Appending and removing from the end are O(log n) per row, inserting or removing in the middle rebuilds in O(n).
+ */
+class COMMONBASICWIDGETS_API FIndexedListOffsetIndex
+{
+public:
+	/** Rebuilds the index with InNum rows of InHeight in O(n). */
+	void Reset(int32 InNum, float InHeight);
+
+	/** Rebuilds the index from explicit heights in O(n). */
+	void Reset(TArray<float>&& InHeights);
+
+	int32 Num() const noexcept { return Heights.Num(); }
+	float GetHeight(int32 InIndex) const { return Heights[InIndex]; }
+
+	/** Returns the height difference applied. */
+	float SetHeight(int32 InIndex, float InHeight);
+
+	/** Sum of the heights of the rows before InIndex. InIndex may be Num(). */
+	double GetOffset(int32 InIndex) const;
+	double GetTotal() const { return GetOffset(Num()); }
+
+	/** Row containing the offset, clamped to the valid rows. INDEX_NONE when empty. */
+	int32 FindIndexAtOffset(double InOffset) const;
+
+	void Insert(int32 InIndex, TArrayView<const float> InHeights);
+	void Remove(int32 InIndex, int32 InCount);
+	void Move(int32 InFromIndex, int32 InToIndex);
+
+private:
+	TArray<float> Heights;
+	/** 1-based Fenwick nodes, Tree[0] is unused. */
+	TArray<double> Tree;
+
+	void Build();
+	void Append(float InHeight);
+	void AddDelta(int32 InIndex, double InDelta);
+};
@@ -0,0 +1,144 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/Object.h"
+#include "IndexedListPagedDataSource.generated.h"
+
+USTRUCT()
+struct FIndexedListPage
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<UObject*> Rows;
+
+	int64 Bytes = 0;
+	uint64 LastAccess = 0;
+};
+
+/**
+ * Fixed size pages of rows fetched asynchronously by subclasses.
+ * Visible pages are requested first, then PrefetchPages ahead of the scroll direction.
+ * Loaded pages are kept under MaxCachedBytes and the least recently used ones are evicted first.
+ */
+UCLASS(Abstract, Blueprintable, EditInlineNew, DefaultToInstanced)
+class COMMONBASICWIDGETS_API UIndexedListPagedDataSource : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPageLoaded, int32 /*FirstIndex*/, int32 /*Count*/);
+
+	FOnPageLoaded OnPageLoaded;
+
+	/** Row of a loaded page, or nullptr while its page is loading or evicted. */
+	UFUNCTION(BlueprintCallable, Category = "Paged Data Source")
+	UObject* GetRow(int32 InIndex);
+
+	UFUNCTION(BlueprintPure, Category = "Paged Data Source")
+	bool IsRowLoaded(int32 InIndex) const;
+
+	/**
+	 * Requests and pins the pages of [InFirstIndex, InEndIndex) and prefetches PrefetchPages towards InScrollDirection,
+	 * forward when positive and backward when negative. 0 keeps the previous direction.
+	 */
+	void NotifyVisibleRange(int32 InFirstIndex, int32 InEndIndex, int32 InTotalCount, int32 InScrollDirection = 0);
+
+	/**
+	 * Same as NotifyVisibleRange for rows that map to scattered items, e.g. through a sorted view.
+	 * Every page holding a visible item is pinned in one call. Pages of InPrefetchItems are requested in order
+	 * until PrefetchPages new pages are found, so callers pass the items of the rows beyond the viewport nearest first.
+	 */
+	void NotifyVisibleItems(TConstArrayView<int32> InVisibleItems, TConstArrayView<int32> InPrefetchItems, int32 InTotalCount);
+
+	/**
+	 * Completes a request started by RequestPage, InRequestId is the one it was given.
+	 * Responses to requests that are no longer pending, or were superseded by a newer request of the page, are ignored.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Paged Data Source")
+	void FulfillPage(int32 InPageIndex, int32 InRequestId, const TArray<UObject*>& InRows, int64 InEstimatedBytes = 0);
+
+	/**
+	 * Marks a request as failed. The page is requested again after RetryDelay, doubled with every further
+	 * failure, while it is still pinned. After MaxRetries it stays failed until RetryFailedPages, InvalidateRange or Reset.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Paged Data Source")
+	void FailPage(int32 InPageIndex, int32 InRequestId);
+
+	/** Requests the pinned pages that ran out of retries again, e.g. once a connection is back. */
+	UFUNCTION(BlueprintCallable, Category = "Paged Data Source")
+	void RetryFailedPages();
+
+	/** Drops every cached page and forgets pending requests. */
+	UFUNCTION(BlueprintCallable, Category = "Paged Data Source")
+	void Reset();
+
+	/**
+	 * Drops cached and pending pages overlapping [InFirstIndex, InEndIndex) after rows moved between indices.
+	 * Results of requests already in flight for them are ignored, also once the pages are requested again.
+	 */
+	void InvalidateRange(int32 InFirstIndex, int32 InEndIndex);
+
+	UFUNCTION(BlueprintPure, Category = "Paged Data Source")
+	int32 GetPageSize() const noexcept;
+
+	UFUNCTION(BlueprintPure, Category = "Paged Data Source")
+	int32 GetPrefetchPages() const noexcept;
+
+	UFUNCTION(BlueprintPure, Category = "Paged Data Source")
+	int64 GetCachedBytes() const noexcept;
+
+	UFUNCTION(BlueprintPure, Category = "Paged Data Source")
+	int32 GetNumCachedPages() const noexcept;
+
+protected:
+	/** Starts fetching a page. Implementations call FulfillPage or FailPage with InRequestId when done, from the game thread. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Paged Data Source")
+	void RequestPage(int32 InPageIndex, int32 InFirstIndex, int32 InCount, int32 InRequestId);
+	virtual void RequestPage_Implementation(int32 InPageIndex, int32 InFirstIndex, int32 InCount, int32 InRequestId);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin="1"), Category = "Paged Data Source")
+	int32 PageSize = 64;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0"), Category = "Paged Data Source")
+	int32 PrefetchPages = 2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0"), Category = "Paged Data Source")
+	int64 MaxCachedBytes = 16 * 1024 * 1024;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0"), Category = "Paged Data Source")
+	int32 MaxRetries = 3;
+
+	/** Delay before the first retry of a failed page. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin="0.0", Units="s"), Category = "Paged Data Source")
+	float RetryDelay = 0.5f;
+
+	virtual void BeginDestroy() override;
+
+private:
+	UPROPERTY(Transient)
+	TMap<int32, FIndexedListPage> Pages;
+
+	/** Request id of every page in flight. */
+	TMap<int32, int32> PendingPages;
+	int32 LastRequestId = 0;
+	TMap<int32, int32> FailedAttempts;
+	TMap<int32, FTSTicker::FDelegateHandle> RetryTickers;
+	int64 CachedBytes = 0;
+	uint64 AccessCounter = 0;
+	int32 TotalCount = 0;
+	int32 ScrollDirection = 1;
+	TSet<int32> PinnedPages;
+
+	void EnsurePageRequested(int32 InPageIndex);
+	bool CompletePendingRequest(int32 InPageIndex, int32 InRequestId);
+	void PinPage(int32 InPageIndex);
+	void RetryPage(int32 InPageIndex);
+	void CancelRetries();
+	bool IsPagePinned(int32 InPageIndex) const;
+	void EvictToBudget();
+	static int64 EstimateRowsBytes(const TArray<UObject*>& InRows);
+};
@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Set of selected indices stored as sorted, disjoint, non-adjacent half-open ranges.
+ * Bulk operations cost O(ranges) no matter how many items they cover, lookups are O(log ranges).
+ */
+class COMMONBASICWIDGETS_API FIndexedListSelection
+{
+public:
+	struct FRange
+	{
+		int32 Start;
+		int32 End;
+
+		int32 Num() const noexcept { return End - Start; }
+	};
+
+	bool Contains(int32 InIndex) const;
+	bool IsEmpty() const noexcept { return Ranges.Num() == 0; }
+	int32 Num() const noexcept { return SelectedCount; }
+	const TArray<FRange>& GetRanges() const noexcept { return Ranges; }
+
+	/** Selects [InStart, InEnd). Returns whether anything changed. */
+	bool Add(int32 InStart, int32 InEnd);
+
+	/** Deselects [InStart, InEnd). Returns whether anything changed. */
+	bool Remove(int32 InStart, int32 InEnd);
+
+	/** Returns the new selection state of the index. */
+	bool Toggle(int32 InIndex);
+
+	void SelectAll(int32 InCount);
+	void Invert(int32 InCount);
+
+	/** Flips the selection state of every index in [InStart, InEnd). */
+	void InvertRange(int32 InStart, int32 InEnd);
+
+	void Empty();
+
+	/** Shifts the selection to make room for InCount unselected items at InIndex. */
+	void InsertGap(int32 InIndex, int32 InCount);
+
+	/** Drops [InIndex, InIndex + InCount) and shifts later selections down. */
+	void Collapse(int32 InIndex, int32 InCount);
+
+	void Move(int32 InFromIndex, int32 InToIndex);
+
+	void GetIndices(TArray<int32>& OutIndices) const;
+
+	bool operator==(const FIndexedListSelection& Other) const;
+	bool operator!=(const FIndexedListSelection& Other) const { return !(*this == Other); }
+
+private:
+	TArray<FRange> Ranges;
+	int32 SelectedCount = 0;
+
+	/** First range whose end is past InIndex. */
+	int32 LowerBound(int32 InIndex) const;
+};
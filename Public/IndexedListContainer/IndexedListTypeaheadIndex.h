@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Item keys sorted case-insensitively for prefix lookups in O(log n).
+ * Built once and never modified afterwards, so it can be handed from a worker thread to the game thread.
+ */
+class COMMONBASICWIDGETS_API FIndexedListTypeaheadIndex
+{
+public:
+	/** InKeys holds one key per item index. Safe to call from any thread. */
+	static TSharedRef<const FIndexedListTypeaheadIndex, ESPMode::ThreadSafe> Build(TArray<FString>&& InKeys);
+
+	/** Position of the first key starting with the prefix, or INDEX_NONE. Keys sharing the prefix follow it. */
+	int32 FindFirstWithPrefix(const FString& InPrefix) const;
+
+	bool HasPrefix(int32 InPosition, const FString& InPrefix) const;
+	int32 GetItemIndex(int32 InPosition) const { return Entries[InPosition].ItemIndex; }
+	int32 Num() const noexcept { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		FString Key;
+		int32 ItemIndex;
+	};
+
+	TArray<FEntry> Entries;
+};
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ * Rows shown by a list as a permutation of source items.
+ * Built once and never modified afterwards, so it can be handed from a worker thread to the game thread.
+ */
+struct COMMONBASICWIDGETS_API FIndexedListViewPermutation
+{
+	TArray<int32> RowToItem;
+	/** INDEX_NONE for items the filter rejected. */
+	TArray<int32> ItemToRow;
+
+	int32 NumRows() const noexcept { return RowToItem.Num(); }
+	int32 NumItems() const noexcept { return ItemToRow.Num(); }
+};
+
+/**
+ * Filter and order of a view. Both predicates are optional and are called concurrently from worker threads,
+ * so they must only read data that is not modified while the view builds, e.g. a snapshot of the sort keys.
+ */
+struct COMMONBASICWIDGETS_API FIndexedListViewDesc
+{
+	TFunction<bool(int32 /*ItemIndex*/)> Filter;
+	TFunction<bool(int32 /*ItemIndexA*/, int32 /*ItemIndexB*/)> Less;
+};
+
+namespace IndexedListView
+{
+	/** Filters and stable sorts [0, InNumItems) with ParallelFor. Safe to call from any thread. */
+	COMMONBASICWIDGETS_API TSharedRef<const FIndexedListViewPermutation, ESPMode::ThreadSafe> Build(int32 InNumItems, const FIndexedListViewDesc& InDesc);
+}
+
+/**
+ * Builds views on worker threads. Only the result of the latest request is ever published,
+ * earlier requests still running are dropped when they finish.
+ */
+class COMMONBASICWIDGETS_API FIndexedListViewBuilder
+{
+public:
+	FIndexedListViewBuilder();
+
+	void Request(int32 InNumItems, const FIndexedListViewDesc& InDesc);
+
+	/** Drops every request in flight. */
+	void Cancel();
+
+	bool IsBuilding() const;
+
+	/** Takes the latest finished view, if any. */
+	TSharedPtr<const FIndexedListViewPermutation, ESPMode::ThreadSafe> ConsumeCompleted();
+
+private:
+	struct FState
+	{
+		FCriticalSection Lock;
+		TSharedPtr<const FIndexedListViewPermutation, ESPMode::ThreadSafe> Completed;
+		std::atomic<uint32> LatestGeneration{0};
+		std::atomic<int32> NumInFlight{0};
+	};
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+};
@@ -4,25 +4,458 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "IndexedListEntryPool.h"
+#include "IndexedListContainer/IndexedListGridLayout.h"
+#include "IndexedListContainer/IndexedListOffsetIndex.h"
+#include "IndexedListContainer/IndexedListSelection.h"
+#include "IndexedListContainer/IndexedListTypeaheadIndex.h"
+#include "IndexedListContainer/IndexedListView.h"
+#include "Tasks/Task.h"
 #include "IndexedListContainer.generated.h"
 
+class UCanvasPanel;
+class UIndexedListPagedDataSource;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnIndexedListItemSelected, int32, InItemIndex);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnIndexedListSelectionChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnIndexedListViewChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnIndexedListEntriesMaterialized, float, InSeconds);
+
+UENUM(BlueprintType)
+enum class EIndexedListSelectionMode : uint8
+{
+	Single,
+	Multi
+};
+
+UENUM(BlueprintType)
+enum class EIndexedListLayout : uint8
+{
+	/** One full width row per item. */
+	List,
+	/** Uniform tiles wrapping into as many columns as the viewport width fits. */
+	Grid
+};
+
+UENUM(BlueprintType)
+enum class EIndexedListNavigation : uint8
+{
+	Previous,
+	Next,
+	/** One row up in list layout, one line of tiles up in grid layout. */
+	Up,
+	Down,
+	PageUp,
+	PageDown,
+	Home,
+	End
+};
+
+UENUM(BlueprintType)
+enum class EIndexedListEventCoalescing : uint8
+{
+	/** Every selection broadcasts right away. */
+	Immediate,
+	/** Broadcasts are deferred to the end of the frame and only the last selected index is delivered. */
+	LastIndex,
+	/** Broadcasts are deferred to the end of the frame and every distinct selected index is delivered once. */
+	UniqueIndices
+};
 
 /**
- * 
+ * List of elements addressed purely by index.
+ * Without virtualization subclasses build their children in OnElementsCountChanged.
+ * With virtualization only the rows inside the viewport plus the overscan are materialized
+ * from EntryWidgetClass into EntriesCanvas.
+ * Rows are display positions and map to item indices through the active view, identity without one.
+ * Selection, events and entry bindings always use item indices.
  */
 UCLASS(Abstract, Blueprintable)
 class COMMONBASICWIDGETS_API UIndexedListContainer : public UUserWidget
 {
 	GENERATED_BODY()
-	
+
 public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnIndexedListItemSelectedNative, int32);
+	DECLARE_MULTICAST_DELEGATE(FOnIndexedListSelectionChangedNative);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnIndexedListEntriesMaterializedNative, float);
+
 	UPROPERTY(BlueprintAssignable)
 	FOnIndexedListItemSelected OnIndexedListItemSelected;
-	
+	FOnIndexedListItemSelectedNative OnIndexedListItemSelectedNative;
+
+	/** Fired once per selection operation, however many items it touched. */
+	UPROPERTY(BlueprintAssignable)
+	FOnIndexedListSelectionChanged OnIndexedListSelectionChanged;
+	FOnIndexedListSelectionChangedNative OnIndexedListSelectionChangedNative;
+
+	/** Fired at frame start when a view built on worker threads replaces the shown rows. */
+	UPROPERTY(BlueprintAssignable)
+	FOnIndexedListViewChanged OnIndexedListViewChanged;
+
+	/**
+	 * Fired when every visible row has its final entry after some were missing or stood in by placeholders.
+	 * InSeconds is the time since the first frame that found the rows missing.
+	 */
+	UPROPERTY(BlueprintAssignable)
+	FOnIndexedListEntriesMaterialized OnIndexedListEntriesMaterialized;
+	FOnIndexedListEntriesMaterializedNative OnIndexedListEntriesMaterializedNative;
+
+	/** Replaces the selection with the item and makes it the anchor for range selection. */
 	UFUNCTION(BlueprintCallable)
 	void SelectItemAtIndex(int32 InIndex);
 
-	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="IndexedListContainer")
+	/** Ctrl-click. Flips the selection state of the item and makes it the anchor. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Selection")
+	void ToggleItemSelection(int32 InIndex);
+
+	/** Selects every item between the two indices, both included. Multi selection only. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Selection")
+	void SelectRange(int32 InFromIndex, int32 InToIndex, bool bInAppend);
+
+	/** Shift-click. Selects from the anchor to the item. Multi selection only. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Selection")
+	void ExtendSelectionToIndex(int32 InIndex, bool bInAppend);
+
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Selection")
+	void SelectAll();
+
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Selection")
+	void InvertSelection();
+
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Selection")
+	void ClearSelection();
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Selection")
+	bool IsItemSelected(int32 InIndex) const;
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Selection")
+	int32 GetSelectedCount() const noexcept;
+
+	/** Expands the selection into indices. O(selected items), prefer GetSelection from native code. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Selection")
+	TArray<int32> GetSelectedIndices() const;
+
+	const FIndexedListSelection& GetSelection() const noexcept;
+
+	/** Delivers coalesced selection events now instead of at the end of the frame. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Selection")
+	void FlushSelectionEvents();
+
+	/** Number of selection broadcasts dropped by coalescing since the last reset. */
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Selection")
+	int32 GetSuppressedSelectionBroadcasts() const noexcept;
+
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Selection")
+	void ResetSuppressedSelectionBroadcasts();
+
+	/**
+	 * Stores the count and fires OnElementsCountChanged. A native event so Blueprints that overrode the former
+	 * implementable event keep compiling. Such overrides replace the native count handling unless they call the parent,
+	 * and the widget compiler warns about them, new Blueprints handle OnElementsCountChanged instead.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category="IndexedListContainer")
 	void SetElementsCount(int32 InCount);
+	virtual void SetElementsCount_Implementation(int32 InCount);
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer")
+	int32 GetElementsCount() const noexcept;
+
+	/** Inserts InCount items before InIndex. Live entries after the insertion point are shifted, not rebuilt. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Changes")
+	void InsertRange(int32 InIndex, int32 InCount);
+
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Changes")
+	void RemoveRange(int32 InIndex, int32 InCount);
+
+	/** Moves one item so that it ends up at InToIndex. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Changes")
+	void MoveItem(int32 InFromIndex, int32 InToIndex);
+
+	/** Rebinds live entries of items whose data changed. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Changes")
+	void UpdateRange(int32 InIndex, int32 InCount);
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer")
+	int32 GetSelectedIndex() const noexcept;
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Virtualization")
+	bool IsVirtualized() const noexcept;
+
+	/**
+	 * Filters and sorts the rows on worker threads. The current rows stay on screen until the new view
+	 * is swapped in at the start of a frame. Structural changes rebuild the view from the same description.
+	 */
+	void RequestView(const FIndexedListViewDesc& InDesc);
+
+	/** Shows every item in index order again. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|View")
+	void ClearView();
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|View")
+	bool HasView() const noexcept;
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|View")
+	bool IsViewBuilding() const;
+
+	/** Rows currently shown. Equals the elements count without a view. */
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|View")
+	int32 GetNumRows() const;
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|View")
+	int32 GetItemIndexForRow(int32 InRow) const;
+
+	/** Returns INDEX_NONE when the view filters the item out. */
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|View")
+	int32 GetRowForItemIndex(int32 InIndex) const;
+
+	/** Pages rows in from the data source instead of expecting entries to know their data. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Data")
+	void SetDataSource(UIndexedListPagedDataSource* InDataSource);
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Data")
+	UIndexedListPagedDataSource* GetDataSource() const noexcept;
+
+	/** Row object of the item from the data source, or nullptr while its page is loading. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Data")
+	UObject* GetItemObject(int32 InIndex) const;
+
+	/** Returns the live entry bound to the item, or nullptr when the item is not materialized. */
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Virtualization")
+	UUserWidget* GetEntryWidgetForIndex(int32 InIndex) const;
+
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Virtualization")
+	void SetScrollOffset(double InScrollOffset);
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Virtualization")
+	double GetScrollOffset() const noexcept;
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Virtualization")
+	double GetContentExtent() const;
+
+	/** Columns of the grid layout for the current viewport width, 1 in list layout. */
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Virtualization")
+	int32 GetNumColumns() const;
+
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Virtualization")
+	void ScrollIndexIntoView(int32 InIndex);
+
+	/** Overrides the estimated height of an item. Live entries refine it again when measured. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Virtualization")
+	void SetItemHeight(int32 InIndex, float InHeight);
+
+	/**
+	 * Builds the typeahead index on a worker thread from one key per item index, e.g. display names.
+	 * Keys are not remapped by structural changes, set them again afterwards.
+	 */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Navigation")
+	void SetTypeaheadKeys(TArray<FString> InKeys);
+
+	/** First shown item whose key starts with the prefix, or INDEX_NONE. Uses the previous index while a new one builds. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Navigation")
+	int32 FindItemByPrefix(const FString& InPrefix);
+
+	/** Moves the selection by rows without needing live entries for the target, e.g. from gamepad input. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Navigation")
+	void NavigateSelection(EIndexedListNavigation InNavigation);
+
+	/** Pre-creates pooled entries, e.g. during a loading screen. Uses EntryWidgetClass when InEntryClass is null. */
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Pool")
+	void WarmUpEntries(int32 InCount, TSubclassOf<UUserWidget> InEntryClass = nullptr);
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Pool")
+	int32 GetEntryPoolHitCount() const noexcept;
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Pool")
+	int32 GetEntryPoolMissCount() const noexcept;
+
+	UFUNCTION(BlueprintCallable, Category="IndexedListContainer|Pool")
+	void ResetEntryPoolStats();
+
+	/** Milliseconds per frame this container may spend building entries, 0 when unlimited. */
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Virtualization")
+	float GetEntryBuildBudgetMs() const;
+
+	UFUNCTION(BlueprintPure, Category="IndexedListContainer|Virtualization")
+	bool AreVisibleEntriesMaterialized() const noexcept;
+
+#if WITH_EDITOR
+	virtual const FText GetPaletteCategory() override;
+	virtual void ValidateCompiledDefaults(class IWidgetCompilerLog& CompileLog) const override;
+#endif
+
+protected:
+	/** Fired whenever the element count changes. Non-virtualized subclasses rebuild their children here. */
+	UFUNCTION(BlueprintImplementableEvent, Category="IndexedListContainer")
+	void OnElementsCountChanged(int32 InCount);
+
+	/** Height assumed for an item until its entry is measured. Only used with bVariableEntryHeights. */
+	virtual float EstimateItemHeight(int32 InIndex) const;
+
+	virtual void NativePreConstruct() override;
+	virtual void NativeOnInitialized() override;
+	virtual void NativeDestruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual FReply NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
+	virtual FReply NativeOnKeyChar(const FGeometry& InGeometry, const FCharacterEvent& InCharEvent) override;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="IndexedListContainer|Virtualization")
+	bool bVirtualize = false;
+
+	/** Entry materialized for every visible row. Must implement IIndexedListEntryInterface. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize", MustImplement="/Script/CommonBasicWidgets.IndexedListEntryInterface"), Category="IndexedListContainer|Virtualization")
+	TSubclassOf<UUserWidget> EntryWidgetClass;
+
+	/** Cheap entry shown for rows whose data is not available yet. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize"), Category="IndexedListContainer|Virtualization")
+	TSubclassOf<UUserWidget> PlaceholderEntryClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize"), Category="IndexedListContainer|Virtualization")
+	EIndexedListLayout Layout = EIndexedListLayout::List;
+
+	/** Height of every row, or the estimate for rows not measured yet when bVariableEntryHeights is set. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize && Layout == EIndexedListLayout::List", EditConditionHides, ClampMin="1.0"), Category="IndexedListContainer|Virtualization")
+	float EntryHeight = 32.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize && Layout == EIndexedListLayout::Grid", EditConditionHides), Category="IndexedListContainer|Virtualization")
+	FVector2D TileSize = FVector2D(128.0, 128.0);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize && Layout == EIndexedListLayout::Grid", EditConditionHides), Category="IndexedListContainer|Virtualization")
+	FVector2D TileSpacing = FVector2D::ZeroVector;
+
+	/** Measures every materialized entry and keeps per row heights in a prefix sum index. List layout only. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize"), Category="IndexedListContainer|Virtualization")
+	bool bVariableEntryHeights = false;
+
+	/** Rows, or lines of tiles, materialized above and below the viewport so short scrolls don't create entries. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize", ClampMin="0"), Category="IndexedListContainer|Virtualization")
+	int32 OverscanCount = 2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize", ClampMin="0.0"), Category="IndexedListContainer|Virtualization")
+	float WheelScrollAmount = 48.f;
+
+	/** Uses EntryBuildBudgetMs instead of the IndexedList.EntryBuildBudgetMs console variable. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bVirtualize", InlineEditConditionToggle), Category="IndexedListContainer|Virtualization")
+	bool bOverrideEntryBuildBudget = false;
+
+	/**
+	 * Entries left over when the budget runs out are built on later frames, nearest to the viewport first,
+	 * and stood in by PlaceholderEntryClass meanwhile. 0 builds everything in one frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bOverrideEntryBuildBudget", ClampMin="0.0", Units="ms"), Category="IndexedListContainer|Virtualization")
+	float EntryBuildBudgetMs = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="IndexedListContainer")
+	bool bScrollSelectionIntoView = true;
+
+	/** Arrow keys, page keys and the gamepad d-pad and shoulders move the selection while the list has keyboard focus. Makes the list focusable. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="IndexedListContainer|Navigation")
+	bool bEnableKeyboardNavigation = true;
+
+	/** Typing while the list has keyboard focus selects the first item whose typeahead key matches the typed text. Makes the list focusable. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="IndexedListContainer|Navigation")
+	bool bEnableTypeahead = true;
+
+	/** Pause after which typing starts a new prefix. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(EditCondition="bEnableTypeahead", ClampMin="0.0", Units="s"), Category="IndexedListContainer|Navigation")
+	float TypeaheadResetDelay = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="IndexedListContainer|Selection")
+	EIndexedListSelectionMode SelectionMode = EIndexedListSelectionMode::Single;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="IndexedListContainer|Selection")
+	EIndexedListEventCoalescing SelectionEventCoalescing = EIndexedListEventCoalescing::Immediate;
+
+	virtual void BeginDestroy() override;
+
+	UPROPERTY(EditAnywhere, Instanced, BlueprintReadOnly, Category="IndexedListContainer|Data")
+	UIndexedListPagedDataSource* DataSource;
+
+#if WITH_DEV_AUTOMATION_TESTS
+	/** Lays out one frame at the given viewport size without a Slate tick. For tests and benchmarks driving the list headless. */
+	void RefreshVirtualizationForTesting(UCanvasPanel* InEntriesCanvas, const FVector2D& InViewportSize);
+#endif
+
+private:
+	/** Viewport of the virtualized rows. Place it inside a widget that clips to bounds. */
+	UPROPERTY(meta=(BindWidgetOptional, AllowPrivateAccess))
+	UCanvasPanel* EntriesCanvas;
+
+	UPROPERTY(Transient)
+	TMap<int32, UUserWidget*> LiveEntries;
+
+	UPROPERTY(Transient)
+	FIndexedListEntryPool EntryPool;
+
+	FIndexedListOffsetIndex RowOffsets;
+	FIndexedListGridLayout GridLayout;
+	FIndexedListSelection Selection;
+
+	TSharedPtr<const FIndexedListViewPermutation, ESPMode::ThreadSafe> ActiveView;
+	TOptional<FIndexedListViewDesc> ViewDesc;
+	FIndexedListViewBuilder ViewBuilder;
+	FDelegateHandle BeginFrameHandle;
+
+	TSharedPtr<const FIndexedListTypeaheadIndex, ESPMode::ThreadSafe> TypeaheadIndex;
+	UE::Tasks::TTask<TSharedRef<const FIndexedListTypeaheadIndex, ESPMode::ThreadSafe>> PendingTypeaheadIndex;
+	FString TypeaheadBuffer;
+	double LastTypeaheadTime = 0.0;
+
+	int32 ElementsCount = 0;
+	bool bElementsCountSet = false;
+	int32 SelectedIndex = INDEX_NONE;
+	double ScrollOffset = 0.0;
+	FVector2D ViewportSize = FVector2D::ZeroVector;
+	bool bVirtualizationDirty = true;
+	bool bVisibleEntriesMaterialized = true;
+	double MaterializationStartTime = 0.0;
+
+	TArray<int32> PendingSelectedIndices;
+	bool bPendingSelectionChanged = false;
+	int32 SuppressedSelectionBroadcasts = 0;
+	FDelegateHandle EndFrameHandle;
+	FDelegateHandle PageLoadedHandle;
+	int32 LastDataSourceFirstRow = 0;
+	int32 DataSourceScrollDirection = 1;
+
+	void RefreshVirtualization();
+	void BuildEntries(int32 InFirstRow, int32 InEndRow);
+	void NotifyDataSourceVisibleRows(int32 InFirstRow, int32 InEndRow);
+	void RequestViewBuild();
+	void SwapInCompletedView();
+	void ApplyView(TSharedPtr<const FIndexedListViewPermutation, ESPMode::ThreadSafe> InView);
+	void RemapView(TFunctionRef<int32(int32)> RemapIndex);
+	void RebindLiveEntries();
+	void ApplySelection(FIndexedListSelection&& InSelection, bool bInAppend);
+	void ConsumeTypeaheadIndex();
+	int32 GetNavigationTargetRow(EIndexedListNavigation InNavigation) const;
+	TSubclassOf<UUserWidget> GetEntryClassForRow(int32 InRow) const;
+	void InvalidateDataSourceRange(int32 InFirstIndex, int32 InEndIndex);
+	void HandlePageLoaded(int32 InFirstIndex, int32 InCount);
+	bool IsGridLayout() const noexcept;
+	bool UsesRowOffsets() const noexcept;
+	void UpdateGridLayout();
+	bool GetVisibleRange(int32& OutFirstRow, int32& OutEndRow) const;
+	bool GetMaterializedRange(int32& OutFirstRow, int32& OutEndRow) const;
+	double GetRowOffset(int32 InRow) const;
+	float GetRowHeight(int32 InRow) const;
+	int32 FindRowAtOffset(double InOffset) const;
+	double GetMaxScrollOffset() const;
+	UUserWidget* AcquireEntry(int32 InRow, TSubclassOf<UUserWidget> InEntryClass);
+	void ReleaseEntry(UUserWidget* Entry);
+	void ReleaseAllEntries();
+	void BindEntry(UUserWidget* Entry, int32 InRow);
+	void MeasureEntry(UUserWidget* Entry, int32 InRow);
+	void RefineRowHeight(int32 InRow, float InHeight);
+	void ResetRowOffsets();
+	void PositionEntry(UUserWidget* Entry, int32 InRow) const;
+	void UpdateEntrySelection(int32 InIndex, bool bInSelected) const;
+	void RefreshLiveEntrySelection() const;
+	void NotifySelectionChanged();
+	void NotifyItemSelected(int32 InIndex);
+	void ScheduleSelectionFlush();
+	bool IsValidItemIndex(int32 InIndex) const;
+	bool CanMultiSelect() const;
+	void RemapIndices(TFunctionRef<int32(int32)> RemapIndex);
 };
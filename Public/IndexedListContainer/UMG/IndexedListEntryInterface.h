@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "IndexedListEntryInterface.generated.h"
+
+class UIndexedListContainer;
+
+// This class does not need to be modified.
+UINTERFACE(BlueprintType, Blueprintable)
+class UIndexedListEntryInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Implemented by entry widgets materialized by a virtualized UIndexedListContainer.
+ * Entries are never told about their position on screen, only about the item they represent.
+ */
+class COMMONBASICWIDGETS_API IIndexedListEntryInterface
+{
+	GENERATED_BODY()
+
+public:
+	/** Called every time the entry starts representing an item. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Indexed List Entry")
+	void BindToIndex(UIndexedListContainer* ListContainer, int32 InItemIndex);
+
+	/** Called instead of BindToIndex when items were inserted or removed before the bound item. The item itself did not change. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Indexed List Entry")
+	void OnEntryIndexShifted(int32 InNewItemIndex);
+
+	/** Called when the selection state of the bound item changes, and right after binding. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Indexed List Entry")
+	void SetEntrySelected(bool bInSelected);
+
+	/** Called when the entry goes back to the pool. Drop references to the previously bound item here. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Indexed List Entry")
+	void OnEntryReleased();
+};
@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IndexedListEntryPool.generated.h"
+
+class UPanelWidget;
+class UUserWidget;
+
+USTRUCT()
+struct FIndexedListEntryBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<UUserWidget*> Entries;
+};
+
+/**
+ * Released entry widgets kept per entry class.
+ * Pooled entries stay parented to the host panel and are only collapsed,
+ * so reusing one allocates neither a widget nor a slot.
+ */
+USTRUCT()
+struct COMMONBASICWIDGETS_API FIndexedListEntryPool
+{
+	GENERATED_BODY()
+
+	/** Returns a pooled entry of the class, or creates one inside the host panel on a miss. */
+	UUserWidget* Acquire(UUserWidget* OwningWidget, UPanelWidget* HostPanel, TSubclassOf<UUserWidget> EntryClass);
+
+	void Release(UUserWidget* Entry);
+
+	/** Pre-creates entries until the pool holds at least InCount free entries of the class. */
+	void WarmUp(UUserWidget* OwningWidget, UPanelWidget* HostPanel, TSubclassOf<UUserWidget> EntryClass, int32 InCount);
+
+	int32 GetNumFree(TSubclassOf<UUserWidget> EntryClass) const;
+	int32 GetHitCount() const noexcept { return HitCount; }
+	int32 GetMissCount() const noexcept { return MissCount; }
+
+	void ResetStats();
+	void Empty();
+
+private:
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<UUserWidget>, FIndexedListEntryBucket> FreeEntries;
+
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+
+	static UUserWidget* CreateEntry(UUserWidget* OwningWidget, UPanelWidget* HostPanel, TSubclassOf<UUserWidget> EntryClass);
+};
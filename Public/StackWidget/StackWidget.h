@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/PanelWidget.h"
+#include "WidgetTransition/WidgetTransitionScheduler.h"
 #include "StackWidget.generated.h"
 
 class UOverlay;
@@ -21,6 +22,20 @@ enum class EStackTransition : uint8
 	Pop
 };
 
+/** How a stack moves its widgets. All of them only change render opacity and render transforms, never layout. */
+UENUM(BlueprintType)
+enum class EStackTransitionStyle : uint8
+{
+	Fade,
+	/** The incoming widget slides in while the outgoing one slides out the other side. */
+	Slide,
+	/** Widgets fade while scaling, pushed widgets grow in and popped ones shrink out. */
+	Scale,
+	/** The top widget slides over the one beneath it, which moves by a fraction of the distance. */
+	PushOver,
+	Num UMETA(Hidden)
+};
+
 USTRUCT(BlueprintType)
 struct FStackAnimationSettings
 {
@@ -34,6 +49,26 @@ struct FStackAnimationSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
 	float ExponentForEasing = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
+	EStackTransitionStyle TransitionStyle = EStackTransitionStyle::Fade;
+
+	/** Scale a pushed widget starts from, a popped one leaves mirrored around 1. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "TransitionStyle == EStackTransitionStyle::Scale", ClampMin = "0.0"), Category = "Animation")
+	float ScaleFrom = 0.9f;
+
+	/** Fraction of the stack width the widget beneath moves by. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "TransitionStyle == EStackTransitionStyle::PushOver", ClampMin = "0.0", ClampMax = "1.0"), Category = "Animation")
+	float PushOverParallax = 0.3f;
+};
+
+/** Resolved once per transition, so applying a frame only interpolates. */
+struct FStackTransitionParams
+{
+	FVector2D IncomingTranslationFrom = FVector2D::ZeroVector;
+	FVector2D OutgoingTranslationTo = FVector2D::ZeroVector;
+	float IncomingScaleFrom = 1.f;
+	float OutgoingScaleTo = 1.f;
 };
 
 /**
@@ -84,25 +119,34 @@ private:
 
 	struct FAnimationState
 	{
-		float ElapsedTime = 0.0f;
 		EStackTransition TransitionType = EStackTransition::None;
 		UWidget* IncomingWidget = nullptr;
 		UWidget* OutgoingWidget = nullptr;
 		bool bIsAnimating = false;
+		FStackTransitionParams Params;
 	};
 
 	FAnimationState AnimState;
 
-	FTSTicker::FDelegateHandle TickerHandle;
+	/** Advanced by the shared FWidgetTransitionScheduler, stacks don't tick on their own. */
+	FWidgetTransitionHandle TransitionHandle;
 
-	void SetAnimationTicking(bool bTicking);
 	void InterruptAnimation();
-	bool Tick(float DeltaTime);
 	bool IsAnimationTicking() const noexcept;
-	void TickAnimation(float DeltaTime);
 	void UpdateWidgetVisibility();
 	void StartTransitionAnimation(EStackTransition TransitionType, UWidget* Incoming, UWidget* Outgoing);
-	void ApplyAnimationToWidget(UWidget* Widget, float Alpha, bool bFadeIn);
+	void ResetWidgetTransition(UWidget* Widget);
 	void AddWidgetToOverlay(UWidget* Widget);
 	void RemoveWidgetFromOverlay(UWidget* Widget);
+
+	/** Instantiated per transition style, so every frame calls the policy directly. */
+	template <typename TPolicy>
+	void StartPolicyTransition();
+
+	/** Also instantiated per present widget, so frames don't check for missing ones. */
+	template <typename TPolicy, bool bHasIncoming, bool bHasOutgoing>
+	void AnimateTransition();
+
+	template <typename TPolicy, bool bHasIncoming, bool bHasOutgoing>
+	void TickAnimation(float EasedAlpha);
 };
\ No newline at end of file
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "TabContentInterface.generated.h"
+
+/** State a tab content keeps across eviction, e.g. scroll offsets or text being typed. */
+USTRUCT(BlueprintType)
+struct FTabContentState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tab Content")
+	TMap<FName, FString> Values;
+
+	/** Free-form payload for native content. */
+	UPROPERTY()
+	TArray<uint8> Data;
+};
+
+// This class does not need to be modified.
+UINTERFACE(BlueprintType, Blueprintable)
+class UTabContentInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Optionally implemented by tab contents that UTabbedWidget may evict or suspend while inactive.
+ */
+class COMMONBASICWIDGETS_API ITabContentInterface
+{
+	GENERATED_BODY()
+
+public:
+	/** Called right before the content is evicted. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Tab Content")
+	FTabContentState SaveTabContentState() const;
+
+	/** Called after evicted content is rebuilt or attached again, before it is shown. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Tab Content")
+	void RestoreTabContentState(const FTabContentState& State);
+
+	/** Called when the tab becomes active, after the content is visible again. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Tab Content")
+	void OnTabContentActivated();
+
+	/**
+	 * Called when the tab becomes inactive, and for content built while its tab is inactive.
+	 * The content is collapsed, which stops its tick, animations, latent actions and paint.
+	 * Work that doesn't depend on the widget being ticked, e.g. timers, should be paused here.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Tab Content")
+	void OnTabContentDeactivated();
+};
@@ -0,0 +1,38 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "TabHeaderEntryInterface.generated.h"
+
+class UTabbedWidget;
+
+// This class does not need to be modified.
+UINTERFACE(BlueprintType, Blueprintable)
+class UTabHeaderEntryInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Implemented by header widgets of a UTabbedWidget with virtualized headers.
+ * Headers are recycled while the strip scrolls, so they read everything they show from the bound tab.
+ */
+class COMMONBASICWIDGETS_API ITabHeaderEntryInterface
+{
+	GENERATED_BODY()
+
+public:
+	/** Called every time the header starts representing a tab, e.g. to read GetTabLabel. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Tab Header Entry")
+	void BindToTab(UTabbedWidget* TabbedWidget, int32 TabIndex);
+
+	/** Called when the bound tab becomes active or inactive, and right after binding. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Tab Header Entry")
+	void SetTabHeaderActive(bool bInActive);
+
+	/** Called when the header leaves the strip and is kept for reuse. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Tab Header Entry")
+	void OnTabHeaderReleased();
+};
@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TabSwitchHistory.generated.h"
+
+UENUM(BlueprintType)
+enum class ETabSwitchPhase : uint8
+{
+	/** The whole synchronous SwitchToTab call, the first paint happens later. */
+	Total,
+	/** Building lazy or evicted content. */
+	Construction,
+	/** Layout prepass of the page being shown, only recorded with TabbedWidget.MeasurePrepass on. */
+	Prepass,
+	/** From showing the page until the widget finished painting it. */
+	FirstPaint,
+	/** OnTabChanged listeners. */
+	Listeners,
+	Num UMETA(Hidden)
+};
+
+USTRUCT(BlueprintType)
+struct FTabSwitchPercentiles
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Tabs")
+	int32 NumSamples = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Tabs")
+	float P50Ms = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Tabs")
+	float P90Ms = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Tabs")
+	float P99Ms = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Tabs")
+	float MaxMs = 0.f;
+};
+
+/** The latest switch timings of one tab per phase, kept in fixed size ring buffers. */
+class COMMONBASICWIDGETS_API FTabSwitchHistory
+{
+public:
+	static constexpr int32 WindowSize = 64;
+
+	void Add(ETabSwitchPhase Phase, float Milliseconds);
+
+	FTabSwitchPercentiles GetPercentiles(ETabSwitchPhase Phase) const;
+
+private:
+	struct FWindow
+	{
+		TArray<float, TInlineAllocator<WindowSize>> Samples;
+		int32 Next = 0;
+	};
+
+	FWindow Windows[static_cast<int32>(ETabSwitchPhase::Num)];
+};
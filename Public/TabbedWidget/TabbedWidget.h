@@ -3,12 +3,125 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "TabContentInterface.h"
 #include "TabInterface.h"
+#include "TabSwitchHistory.h"
 #include "Blueprint/UserWidget.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "WidgetTransition/WidgetTransitionScheduler.h"
 #include "TabbedWidget.generated.h"
 
+class UComboBoxString;
+class USizeBox;
+struct FStreamableHandle;
+class UTabHeaderClickProxy;
 class UWidgetSwitcher;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTabChanged, int32, TabIndex);
+DECLARE_DYNAMIC_DELEGATE_RetVal(UUserWidget*, FTabContentFactory);
+
+UENUM(BlueprintType)
+enum class ETabTransition : uint8
+{
+	None,
+	Fade,
+	Slide
+};
+
+/**
+ * One tab. Content added as a class or a factory is built on first activation,
+ * until then a placeholder stands in for it in the content switcher.
+ */
+USTRUCT()
+struct FTabEntry
+{
+	GENERATED_BODY()
+
+	/** Stays the same while indices shift around it. */
+	UPROPERTY()
+	FGuid TabId;
+
+	/** Null while headers are virtualized, the strip materializes them from HeaderWidgetClass. */
+	UPROPERTY()
+	UUserWidget* Header = nullptr;
+
+	UPROPERTY()
+	UTabHeaderClickProxy* ClickProxy = nullptr;
+
+	/** Shown by virtualized headers and the overflow dropdown. */
+	UPROPERTY()
+	FText Label;
+
+	/** Null until the content is built. */
+	UPROPERTY()
+	UUserWidget* Content = nullptr;
+
+	UPROPERTY()
+	UWidget* Placeholder = nullptr;
+
+	/** Set once SoftContentClass finished loading for tabs added with a soft class, cleared again when their content is evicted. */
+	UPROPERTY()
+	TSubclassOf<UUserWidget> ContentClass;
+
+	UPROPERTY()
+	TSoftClassPtr<UUserWidget> SoftContentClass;
+
+	/** Streams SoftContentClass in, cancelled when the tab is removed. */
+	TSharedPtr<FStreamableHandle> LoadHandle;
+
+	TFunction<UUserWidget*()> ContentFactory;
+
+	UPROPERTY()
+	FTabContentState SavedState;
+
+	bool bHasSavedState = false;
+
+	/** Eager content that was evicted keeps its UObject but not its Slate widgets. */
+	bool bContentDetached = false;
+
+	/** Content of an inactive tab is collapsed, ContentVisibility is restored on activation. */
+	bool bContentSuspended = false;
+	ESlateVisibility ContentVisibility = ESlateVisibility::SelfHitTestInvisible;
+
+#if !UE_BUILD_SHIPPING
+	/** Frames the content was painted or animated while suspended. */
+	int32 SuspendedWorkCount = 0;
+	uint32 SuspendedPaintFrame = 0;
+#endif
+
+	uint64 LastUsed = 0;
+	int64 EstimatedBytes = 0;
+
+	FTabSwitchHistory SwitchHistory;
+
+	bool IsLazy() const { return ContentClass != nullptr || ContentFactory != nullptr || !SoftContentClass.IsNull(); }
+	bool IsContentLive() const { return Content != nullptr && !bContentDetached; }
+
+	/** Widget standing for the tab in the content switcher. */
+	UWidget* GetSwitcherWidget() const { return Placeholder ? Placeholder : Content; }
+};
+
+/** Recycled header of the virtualized header strip. */
+USTRUCT()
+struct FTabHeaderStripSlot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UUserWidget* Header = nullptr;
+
+	UPROPERTY()
+	UTabHeaderClickProxy* ClickProxy = nullptr;
+
+	/** Holds the header at HeaderExtent in the strip, collapsed while released. */
+	UPROPERTY()
+	USizeBox* SizeBox = nullptr;
+
+	/** INDEX_NONE while released. */
+	int32 TabIndex = INDEX_NONE;
+	FGuid TabId;
+	bool bActive = false;
+};
 
 /**
  * 
@@ -24,9 +137,119 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tabs")
 	void AddTab(UUserWidget* TabHeaderWidget, UUserWidget* TabContentWidget);
 
+	/** Adds a tab whose content is created from the class the first time the tab is activated or prewarmed. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void AddTabWithContentClass(UUserWidget* TabHeaderWidget, TSubclassOf<UUserWidget> TabContentClass);
+
+	/** Adds a tab whose content is returned by the factory the first time the tab is activated or prewarmed. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void AddTabWithContentFactory(UUserWidget* TabHeaderWidget, FTabContentFactory TabContentFactory);
+
+	void AddTabWithNativeContentFactory(UUserWidget* TabHeaderWidget, TFunction<UUserWidget*()>&& TabContentFactory);
+
+	/**
+	 * Adds a tab whose content class is streamed in asynchronously the first time the tab is activated or prewarmed,
+	 * LoadingPlaceholderClass stands in for it meanwhile.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void AddTabWithSoftContentClass(UUserWidget* TabHeaderWidget, TSoftClassPtr<UUserWidget> TabContentClass);
+
+	/** Adds a tab without a header widget, for virtualized headers. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void AddLabeledTab(const FText& Label, UUserWidget* TabContentWidget);
+
+	/** Adds a tab without a header widget whose content is created from the class on first activation, for virtualized headers. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void AddLabeledTabWithContentClass(const FText& Label, TSubclassOf<UUserWidget> TabContentClass);
+
+	/** Adds a tab without a header widget whose content class is streamed in on first activation or prewarm, for virtualized headers. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void AddLabeledTabWithSoftContentClass(const FText& Label, TSoftClassPtr<UUserWidget> TabContentClass);
+
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	bool IsTabContentLoading(int32 TabIndex) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	FText GetTabLabel(int32 TabIndex) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void SetTabLabel(int32 TabIndex, const FText& Label);
+
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	bool UsesHeaderStrip() const;
+
+	/** Moves the virtualized header strip by Delta tabs, without changing the active tab. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void ScrollHeaderStrip(int32 Delta);
+
+	/** Index of the first tab with a materialized header. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	int32 GetFirstStripTabIndex() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	int32 GetNumStripHeaders() const;
+
+	/** Builds the content of a lazy tab without activating it. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void PrewarmTab(int32 TabIndex);
+
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	bool IsTabContentBuilt(int32 TabIndex) const;
+
+	/** Returns null for lazy tabs that were not built yet. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	UUserWidget* GetTabContent(int32 TabIndex) const;
+
+	/**
+	 * Releases the content of an inactive tab. Lazy tabs drop the content and build it again on activation,
+	 * tabs added with a content widget only release its Slate widgets. ITabContentInterface state survives both.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void EvictTabContent(int32 TabIndex);
+
+	/**
+	 * Frames the content of the tab was painted or played widget animations while its tab was inactive. Stays 0 when suspension
+	 * works, and in shipping. NativeTick and latent actions are not observable from outside the content and are not counted.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	int32 GetTabSuspendedWorkCount(int32 TabIndex) const;
+
+	/** Milliseconds the last SwitchToTab took, also published as the TabbedWidget stat. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	float GetLastSwitchLatencyMs() const;
+
+	/** Percentiles of a phase over the latest switches to the tab, also dumped by TabbedWidget.DumpSwitchStats. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	FTabSwitchPercentiles GetTabSwitchPercentiles(int32 TabIndex, ETabSwitchPhase Phase) const;
+
+	/** Logs the switch percentiles of every tab. */
+	void DumpSwitchStats() const;
+
+	/** Adds header and content pairs in one update. Both arrays must have the same length and no null entries, otherwise nothing is added. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void AddTabs(const TArray<UUserWidget*>& TabHeaderWidgets, const TArray<UUserWidget*>& TabContentWidgets);
+
+	/** Replaces all tabs in one update. Arrays AddTabs would reject leave the current tabs untouched. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void SetTabs(const TArray<UUserWidget*>& TabHeaderWidgets, const TArray<UUserWidget*>& TabContentWidgets);
+
 	UFUNCTION(BlueprintCallable, Category = "Tabs")
 	void RemoveTab(int32 TabIndex);
 
+	/** Removes [FirstTabIndex, FirstTabIndex + Count) in one update. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void RemoveTabs(int32 FirstTabIndex, int32 Count);
+
+	/**
+	 * Defers tab activation until the matching EndUpdate, so any number of adds, removals and switches in between
+	 * build content and broadcast OnTabChanged at most once. Calls nest.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void BeginUpdate();
+
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void EndUpdate();
+
 	UFUNCTION(BlueprintCallable, Category = "Tabs")
 	void SwitchToTab(int32 TabIndex);
 
@@ -36,33 +259,202 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tabs")
 	int32 GetTabCount() const;
 
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	FGuid GetTabId(int32 TabIndex) const;
+
+	/** Returns INDEX_NONE when no tab has the id. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	int32 FindTabIndexById(const FGuid& TabId) const;
+
+	/** Returns INDEX_NONE when the widget is not a tab header of this widget. */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	int32 FindTabIndexByHeader(UUserWidget* TabHeaderWidget) const;
+
 	UFUNCTION(BLueprintCallable, Category = "Tabs")
 	void ClearTabs();
 
+	/**
+	 * Writes tab ids, labels, content classes, saved content states and the active tab to a compact binary snapshot.
+	 * Tabs whose content class is unknown, i.e. factory tabs that were never built, are left out.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	void SaveTabsSnapshot(TArray<uint8>& OutData) const;
+
+	/**
+	 * Replaces all tabs with the ones of a snapshot. Content classes are soft, so only the one of the active tab is streamed in and built,
+	 * with its saved state restored. Headers come from HeaderWidgetClass. Returns false, leaving the tabs as they were, on invalid data.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tabs")
+	bool RestoreTabsSnapshot(const TArray<uint8>& Data);
+
 #if WITH_EDITOR
 	virtual void ValidateCompiledDefaults(class IWidgetCompilerLog& CompileLog) const override;
 	virtual const FText GetPaletteCategory() override;
 #endif
+
+protected:
+	virtual void NativeOnInitialized() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual void BeginDestroy() override;
+
+	/** Rough memory held by a built tab content, used against MaxLiveContentBytes. */
+	virtual int64 EstimateTabContentBytes(const UUserWidget* Content) const;
+
 private:
 	UPROPERTY(EditAnywhere, meta=(AllowPrivateAccess))
 	UPanelWidget* TabHeadersContainer;
 	UPROPERTY(EditDefaultsOnly, meta = (BindWidget, AllowPrivateAccess))
 	UWidgetSwitcher* ContentSwitcher;
+
+	/** Lists the tabs whose headers don't fit the virtualized strip. Options are built when it opens. */
+	UPROPERTY(EditDefaultsOnly, meta = (BindWidgetOptional, AllowPrivateAccess))
+	UComboBoxString* OverflowComboBox;
+
+	/**
+	 * TabHeadersContainer only holds headers of HeaderWidgetClass for the tabs that fit its width, recycled as the strip scrolls.
+	 * Tabs are then added without header widgets, e.g. with AddLabeledTab. The container should get its width from its parent.
+	 */
+	UPROPERTY(EditAnywhere, meta = (AllowPrivateAccess), Category = "Tabs")
+	bool bVirtualizeHeaders = false;
+
+	/** Header of virtualized tabs, and of tabs restored from a snapshot when headers are not virtualized. */
+	UPROPERTY(EditAnywhere, meta = (MustImplement = "/Script/CommonBasicWidgets.TabInterface", AllowPrivateAccess), Category = "Tabs")
+	TSubclassOf<UUserWidget> HeaderWidgetClass;
+
+	/** Width every virtualized header is sized to. */
+	UPROPERTY(EditAnywhere, meta = (EditCondition = "bVirtualizeHeaders", ClampMin = "1.0", AllowPrivateAccess), Category = "Tabs")
+	float HeaderExtent = 160.f;
+
+	/**
+	 * The page on screen fades or slides out, then the active one in, each over half of TransitionSettings.Duration.
+	 * Switching again midway turns the running transition around from where it is.
+	 */
+	UPROPERTY(EditAnywhere, meta = (AllowPrivateAccess), Category = "Tabs")
+	ETabTransition Transition = ETabTransition::None;
+
+	UPROPERTY(EditAnywhere, meta = (EditCondition = "Transition != ETabTransition::None", AllowPrivateAccess), Category = "Tabs")
+	FWidgetTransitionSettings TransitionSettings;
+
+	UPROPERTY(EditAnywhere, meta = (EditCondition = "Transition == ETabTransition::Slide", AllowPrivateAccess), Category = "Tabs")
+	float SlideDistance = 60.f;
+
+	/** Built tab contents kept alive including the active one, least recently used are evicted beyond it. 0 keeps all. */
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0", AllowPrivateAccess), Category = "Tabs")
+	int32 MaxLiveTabs = 0;
+
+	/** Estimated bytes of built tab contents kept alive, least recently used are evicted beyond it. 0 keeps all. */
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0", AllowPrivateAccess), Category = "Tabs")
+	int64 MaxLiveContentBytes = 0;
+
+	/** Shown while the content class of a tab streams in, an empty spacer when not set. Should be cheap to create. */
+	UPROPERTY(EditAnywhere, meta = (AllowPrivateAccess), Category = "Tabs")
+	TSubclassOf<UUserWidget> LoadingPlaceholderClass;
+
+	/**
+	 * Builds and prepasses the lazy tabs next to the active one in the background, so switching to them builds nothing.
+	 * Only as many as MaxLiveTabs leaves room for.
+	 */
+	UPROPERTY(EditAnywhere, meta = (AllowPrivateAccess), Category = "Tabs")
+	bool bPrewarmAdjacentTabs = false;
+
+	/** Time per frame spent prewarming. A single tab build is never split, so one step may overrun it. */
+	UPROPERTY(EditAnywhere, meta = (EditCondition = "bPrewarmAdjacentTabs", ClampMin = "0.0", Units = "ms", AllowPrivateAccess), Category = "Tabs")
+	float PrewarmBudgetMs = 4.f;
 	
 	UPROPERTY()
-	TArray<UUserWidget*> TabHeaders;
+	TArray<FTabEntry> Tabs;
+
+	TMap<FGuid, int32> TabIndexById;
+	TMap<TObjectKey<UUserWidget>, int32> TabIndexByHeader;
+
 	UPROPERTY()
-	TArray<UUserWidget*> TabContents;
+	TArray<FTabHeaderStripSlot> HeaderStripSlots;
 
-	FOnTabHeaderClickedEvent OnClickedDelegate;
+	/** Tab index of every overflow dropdown option. */
+	TArray<int32> OverflowTabIndices;
+
+	int32 HeaderStripFirst = 0;
+	int32 HeaderStripCapacity = 0;
+	int32 OverflowWindowFirst = INDEX_NONE;
+	int32 OverflowWindowEnd = INDEX_NONE;
+	bool bOverflowDirty = false;
 
 	int32 ActiveTabIndex = -1;
+	/** Tab whose content is in ContentSwitcher, it lags behind the active tab while a transition runs. */
+	FGuid DisplayedTabId;
+
+	FWidgetTransitionHandle TransitionHandle;
+	float TransitionValue = 1.f;
+	float SlideDirection = -1.f;
+	int32 UpdateDepth = 0;
+	int32 ActiveTabIndexBeforeUpdate = -1;
+	FGuid ActiveTabIdBeforeUpdate;
+	uint64 TabUseCounter = 0;
+	float LastSwitchLatencyMs = 0.f;
+	bool bRequestingContentLoad = false;
+
+	/** Tab shown last whose first paint is not recorded yet. */
+	FGuid FirstPaintTabId;
+	double FirstPaintStartTime = 0.0;
+	mutable double LastPaintTime = 0.0;
+
+	struct FPrewarmStep
+	{
+		int32 TabIndex;
+		bool bPrepass;
+	};
+
+	TArray<FPrewarmStep> PrewarmSteps;
+	FTSTicker::FDelegateHandle PrewarmTickerHandle;
 	
-	void RegisterTabHeader(UUserWidget* TabHeaderWidget);
-	void UnregisterTabHeader(UUserWidget* TabHeaderWidget);
+	void AddTabEntry(FTabEntry&& Entry);
+	/** Only a switch notifies listeners and records its latency. */
+	void ActivateTab(int32 TabIndex, bool bSwitched);
+	void DisplayActiveTab();
+	bool StartContentTransition();
+	void AnimateContentTransition(float Target);
+	void ApplyContentTransition(float Value);
+	void StopContentTransition();
+	/** TabIndex follows the tab when a content factory moved it, and is INDEX_NONE when the factory removed it. */
+	bool EnsureTabContent(int32& TabIndex, bool bHighPriorityLoad = false);
+	bool ResolveContentClass(int32 TabIndex, bool bHighPriorityLoad);
+	void OnContentClassLoaded(FGuid TabId);
+	void CancelContentLoad(FTabEntry& Entry);
+	void SetSwitcherChild(int32 TabIndex, UWidget* Widget);
+	void SuspendTabContent(FTabEntry& Entry);
+	void ResumeTabContent(FTabEntry& Entry);
+	void CountSuspendedWork();
+	void RecordFirstPaint();
+	void EvictToBudget();
+	int32 CountLiveTabs() const;
+	void SchedulePrewarm();
+	void StartPrewarmTicker();
+	void CancelPrewarm();
+	bool TickPrewarm(float DeltaTime);
+	void RunPrewarmStep(const FPrewarmStep& Step);
+	void RegisterTabHeader(FTabEntry& Entry);
+	void UnregisterTabHeader(FTabEntry& Entry);
+	void ReindexTabs(int32 FirstTabIndex);
 	void NotifyTabChanged(int32 NewTabIndex);
+	int32 ComputeHeaderStripCapacity() const;
+	void BringTabHeaderIntoView(int32 TabIndex);
+	void RefreshHeaderStrip();
+	bool AddHeaderStripSlot();
+	void BindHeaderStripSlot(FTabHeaderStripSlot& StripSlot, int32 TabIndex);
+	void ReleaseHeaderStripSlot(FTabHeaderStripSlot& StripSlot);
+	void RebuildOverflowOptions();
+
+	UFUNCTION()
+	void OnOverflowSelectionChanged(FString SelectedItem, ESelectInfo::Type SelectionType);
+
+	UFUNCTION()
+	void OnOverflowOpening();
 
 	UFUNCTION()
-	void OnTabClicked(TScriptInterface<ITabInterface> TabHeader);
-	int32 GetTabIndex(UUserWidget* TabWidget) const noexcept;
+	UWidget* GenerateOverflowOption(FString Item);
+
+	friend class UTabHeaderClickProxy;
+	void OnTabClicked(const FGuid& TabId);
 };
@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "WidgetTransitionScheduler.generated.h"
+
+namespace EEasingFunc
+{
+	enum Type : int;
+}
+
+USTRUCT(BlueprintType)
+struct FWidgetTransitionSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
+	float Duration = 0.2f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
+	TEnumAsByte<EEasingFunc::Type> EasingFunction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation")
+	float ExponentForEasing = 2.0f;
+};
+
+struct FWidgetTransitionHandle
+{
+	uint32 Id = 0;
+
+	bool IsValid() const noexcept { return Id != 0; }
+	void Reset() noexcept { Id = 0; }
+};
+
+/**
+ * Evaluates every running widget transition from a single core ticker, so animating widgets don't tick themselves.
+ * Transitions are kept in one dense array. The ticker is added with the first transition and stays, returning right away while nothing runs.
+ */
+class COMMONBASICWIDGETS_API FWidgetTransitionScheduler
+{
+public:
+	using FApplyFunc = TFunction<void(float /*Value*/)>;
+	using FFinishedFunc = TFunction<void()>;
+
+	static FWidgetTransitionScheduler& Get();
+
+	/**
+	 * Eases a value from InFrom to InTo over InDuration seconds, calling InApply with it every frame and InOnFinished once InTo is reached.
+	 * Passing the handle of a running transition retargets it, it then continues from its current value and InFrom is ignored.
+	 * Callbacks stop as soon as InOwner is destroyed.
+	 */
+	FWidgetTransitionHandle Animate(FWidgetTransitionHandle InHandle, const UObject* InOwner, float InFrom, float InTo, float InDuration,
+		const FWidgetTransitionSettings& InSettings, FApplyFunc&& InApply, FFinishedFunc&& InOnFinished = nullptr);
+
+	/** Stops without applying the target value or calling the finished callback, also when it finished earlier in the current frame. */
+	void Stop(FWidgetTransitionHandle& InOutHandle);
+
+	/** Removes the ticker and drops running transitions without calling their callbacks. Called when the module shuts down. */
+	void Shutdown();
+
+	bool IsRunning(FWidgetTransitionHandle InHandle) const;
+	int32 GetNumRunning() const;
+
+private:
+	struct FTransition
+	{
+		uint32 Id = 0;
+		TWeakObjectPtr<const UObject> Owner;
+		float From = 0.f;
+		float To = 0.f;
+		float Value = 0.f;
+		float Elapsed = 0.f;
+		float Duration = 0.f;
+		TEnumAsByte<EEasingFunc::Type> EasingFunction;
+		float ExponentForEasing = 2.f;
+		bool bStopped = false;
+		FApplyFunc Apply;
+		FFinishedFunc OnFinished;
+	};
+
+	TArray<FTransition> Transitions;
+	TMap<uint32, int32> TransitionIndexById;
+
+	/** Requests made by callbacks while ticking, applied after the frame so callbacks never see the array change. */
+	TArray<FTransition> PendingTransitions;
+
+	/** Callbacks of the transitions finished this frame by id, an id of 0 marks one stopped before it was called. */
+	using FFinishedCallback = TPair<uint32, FFinishedFunc>;
+	TArray<FFinishedCallback, TInlineAllocator<8>> FinishedCallbacks;
+
+	uint32 LastId = 0;
+	bool bTicking = false;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	void StartOrRetarget(FTransition&& Request);
+	void CancelFinishedCallback(uint32 InId);
+	void RemoveAtSwap(int32 Index);
+	bool Tick(float DeltaTime);
+};